@@ -26,7 +26,10 @@ public class MaterialInstanceRenamer : ModuleRules
             {
                 "Slate",
                 "SlateCore",
-                "Settings"
+                "Settings",
+                "Json",
+                "SourceControl",
+                "DirectoryWatcher"
             }
         );
 
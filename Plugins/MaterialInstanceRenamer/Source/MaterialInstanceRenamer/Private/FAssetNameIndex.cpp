@@ -0,0 +1,61 @@
+// Copyright 2026 kurorekish. All Rights Reserved.
+
+#include "FAssetNameIndex.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "AssetRegistry/ARFilter.h"
+#include "Misc/PackageName.h"
+
+void FAssetNameIndex::AddPackagePaths(const IAssetRegistry& AssetRegistry, TConstArrayView<FName> PackagePaths)
+{
+	FARFilter Filter;
+	Filter.bRecursivePaths = false;
+	for (const FName PackagePath : PackagePaths)
+	{
+		if (!NamesByPath.Contains(PackagePath))
+		{
+			NamesByPath.Add(PackagePath);
+			Filter.PackagePaths.Add(PackagePath);
+		}
+	}
+
+	if (Filter.PackagePaths.IsEmpty())
+	{
+		return;
+	}
+
+	// A single registry query for all paths; nothing is loaded.
+	AssetRegistry.EnumerateAssets(Filter, [this](const FAssetData& AssetData)
+	{
+		AddName(AssetData.PackagePath, AssetData.AssetName);
+		AddName(AssetData.PackagePath, FPackageName::GetShortFName(AssetData.PackageName));
+		return true;
+	});
+}
+
+void FAssetNameIndex::AddName(FName PackagePath, FName ObjectName)
+{
+	NamesByPath.FindOrAdd(PackagePath).Add(ObjectName);
+}
+
+bool FAssetNameIndex::Contains(FName PackagePath, FName ObjectName) const
+{
+	const TSet<FName>* Names = NamesByPath.Find(PackagePath);
+	return Names && Names->Contains(ObjectName);
+}
+
+FName FAssetNameIndex::ReserveUniqueName(FName PackagePath, FStringView BaseName)
+{
+	TSet<FName>& Names = NamesByPath.FindOrAdd(PackagePath);
+
+	FName Candidate(BaseName);
+	TStringBuilder<NAME_SIZE> Builder;
+	for (int32 Suffix = 1; Names.Contains(Candidate); ++Suffix)
+	{
+		Builder.Reset();
+		Builder << BaseName << Suffix;
+		Candidate = FName(Builder.ToView());
+	}
+
+	Names.Add(Candidate);
+	return Candidate;
+}
@@ -1,146 +1,641 @@
 // Copyright 2026 kurorekish. All Rights Reserved.
 
 #include "FAssetRenameUtil.h"
+#include "FAssetNameIndex.h"
+#include "FRenameRuleSet.h"
+#include "FRenameRuleTable.h"
+#include "FRenameSourceControl.h"
+#include "MaterialInstanceRenamerTrace.h"
 #include "MaterialInstanceRenamerSettings.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "AssetToolsModule.h"
 #include "IAssetTools.h"
 #include "UObject/UObjectGlobals.h"
 #include "UObject/Package.h"
+#include "UObject/UObjectHash.h"
+#include "UObject/ObjectRedirector.h"
+#include "Materials/MaterialInstanceConstant.h"
 #include "Misc/Paths.h"
+#include "Misc/PackageName.h"
+#include "HAL/PlatformTime.h"
 #include "Logging/LogMacros.h"
 #include "UObject/Object.h"
+#include "Algo/Sort.h"
+#include "Async/ParallelFor.h"
+#include "Algo/Count.h"
+#include "Containers/BitArray.h"
+#include <atomic>
 
 
-// Define a structure to hold renaming patterns
-struct FRenamePattern
+namespace AssetRenameUtil_Private
 {
-	FString Prefix;
-	FString Suffix;
-	int32 PrefixLen;
-	int32 SuffixLen;
+	// Reasons reported in plan entries and outcomes
+	static const TCHAR* const ReasonWillRename = TEXT("Matches a naming pattern");
+	static const TCHAR* const ReasonRenamed = TEXT("Renamed");
+	static const TCHAR* const ReasonHasPrefix = TEXT("Already has the recommended prefix");
+	static const TCHAR* const ReasonNoPattern = TEXT("Does not match any expected naming pattern");
+	static const TCHAR* const ReasonNoRules = TEXT("No naming rules for the asset's class");
+	static const TCHAR* const ReasonLoadFailed = TEXT("Failed to load asset");
+	static const TCHAR* const ReasonRenameFailed = TEXT("AssetTools did not rename the asset");
+	static const TCHAR* const ReasonCheckOutFailed = TEXT("Failed to check out the packages of the batch");
 
-	FRenamePattern(const FString& InPrefix, const FString& InSuffix)
-		: Prefix(InPrefix), Suffix(InSuffix), PrefixLen(InPrefix.Len()), SuffixLen(InSuffix.Len())
-	{}
-};
+	// Minimum number of names classified per worker task
+	static constexpr int32 ClassifyMinBatchSize = 1024;
+
+	// Classifications completed without building a new name, over the lifetime of the process
+	static std::atomic<int64> NumNamesKeptTotal{ 0 };
+
+	// Class paths of UMaterialInstanceConstant and all of its subclasses, computed on first use
+	static const TSet<FTopLevelAssetPath>& GetMaterialInstanceClassPaths()
+	{
+		static const TSet<FTopLevelAssetPath> ClassPaths = []()
+		{
+			TArray<UClass*> DerivedClasses;
+			GetDerivedClasses(UMaterialInstanceConstant::StaticClass(), DerivedClasses, true);
+
+			TSet<FTopLevelAssetPath> Paths;
+			Paths.Add(UMaterialInstanceConstant::StaticClass()->GetClassPathName());
+			for (const UClass* DerivedClass : DerivedClasses)
+			{
+				Paths.Add(DerivedClass->GetClassPathName());
+			}
+			return Paths;
+		}();
+		return ClassPaths;
+	}
+
+	// Brings an asset into memory so it can be handed to AssetTools
+	static UObject* LoadAssetForRename(const FSoftObjectPath& ObjectPath)
+	{
+		if (UObject* LoadedObject = ObjectPath.ResolveObject())
+		{
+			return LoadedObject;
+		}
+
+		MIRENAMER_TRACE_SCOPE(LoadAsset);
+		TRACE_COUNTER_INCREMENT(MIRenamer_AssetsLoaded);
+
+		return ObjectPath.TryLoad();
+	}
+}
+
+bool FAssetRenameUtil::IsMaterialInstance(const FAssetData& AssetData)
+{
+	return AssetRenameUtil_Private::GetMaterialInstanceClassPaths().Contains(AssetData.AssetClassPath);
+}
 
 // Rule-based approach for extracting the base name
-bool FAssetRenameUtil::ExtractBaseName(const FString& OldAssetName, FString& OutBaseName)
+bool FAssetRenameUtil::ExtractBaseName(const FString& OldAssetName, const FRenameRuleSet& Rules, FString& OutBaseName)
+{
+	FStringView BaseName;
+	if (Rules.ExtractBaseName(OldAssetName, BaseName))
+	{
+		OutBaseName = FString(BaseName);
+		return true;
+	}
+
+	UE_LOG(LogTemp, Warning, TEXT("Asset '%s' does not match any expected naming pattern."), *OldAssetName);
+	return false;
+}
+
+// Main function to orchestrate the renaming process
+ERenameResult FAssetRenameUtil::RenameMaterialInstance(const FAssetData& SelectedAsset, FString& OutNewName)
+{
+	TArray<FRenameOutcome> Outcomes;
+	RenameMaterialInstances(MakeArrayView(&SelectedAsset, 1), Outcomes);
+	if (Outcomes.IsEmpty())
+	{
+		return ERenameResult::Failed;
+	}
+
+	OutNewName = Outcomes[0].NewName;
+	return Outcomes[0].Result;
+}
+
+// Renames the assets in chunks by planning first and then executing the plan
+void FAssetRenameUtil::RenameMaterialInstances(TConstArrayView<FAssetData> Assets, TArray<FRenameOutcome>& OutOutcomes, const FRenameBatchOptions& Options)
+{
+	FRenamePlan Plan = PlanRenames(Assets);
+	GroupRenamesByReferencers(Plan, Options.BatchSize);
+	ExecuteRenamePlan(Plan.GetEntries(), OutOutcomes, Options);
+}
+
+// Builds the rename plan from asset registry data only
+FRenamePlan FAssetRenameUtil::PlanRenames(TConstArrayView<FAssetData> Assets)
+{
+	FAssetNameIndex NameIndex;
+	return PlanRenames(Assets, NameIndex);
+}
+
+FRenamePlan FAssetRenameUtil::PlanRenames(TConstArrayView<FAssetData> Assets, FAssetNameIndex& NameIndex)
+{
+	const FRenameRuleTable Rules = FRenameRuleTable::FromSettings(*GetDefault<UMaterialInstanceRenamerSettings>());
+	return PlanRenames(Assets, Rules, NameIndex);
+}
+
+FRenamePlan FAssetRenameUtil::PlanRenames(TConstArrayView<FAssetData> Assets, const FRenameRuleSet& Rules, FAssetNameIndex& NameIndex)
 {
-	const UMaterialInstanceRenamerSettings* Settings = GetDefault<UMaterialInstanceRenamerSettings>();
-	const FString& CurrentPrefix = Settings->RenamePrefix;
-	const FString& TargetSourcePrefix = Settings->SourcePrefix;
+	return PlanRenames(Assets, [&Rules](const FAssetData&) { return &Rules; }, NameIndex);
+}
+
+FRenamePlan FAssetRenameUtil::PlanRenames(TConstArrayView<FAssetData> Assets, const FRenameRuleTable& Rules, FAssetNameIndex& NameIndex)
+{
+	return PlanRenames(Assets, [&Rules](const FAssetData& Asset) { return Rules.Find(Asset); }, NameIndex);
+}
+
+FRenamePlan FAssetRenameUtil::PlanRenames(TConstArrayView<FAssetData> Assets, TFunctionRef<const FRenameRuleSet*(const FAssetData&)> FindRules, FAssetNameIndex& NameIndex)
+{
+	using namespace AssetRenameUtil_Private;
+	MIRENAMER_TRACE_SCOPE(PlanRenames);
+	TRACE_COUNTER_ADD(MIRenamer_AssetsClassified, Assets.Num());
 
-	static TArray<FRenamePattern> Patterns;
-	static FString LastPrefix;
-	static FString LastSourcePrefix;
+	// Rule sets are immutable, so they can be shared by the workers.
+	FRenamePlan Plan;
+	Plan.Entries.SetNum(Assets.Num());
 
-	// Rebuild patterns only if the prefix settings have changed or this is the first run
-	if (Patterns.IsEmpty() || LastPrefix != CurrentPrefix || LastSourcePrefix != TargetSourcePrefix)
+	TArray<FString> NewAssetNames;
+	NewAssetNames.SetNum(Assets.Num());
+
+	// 1. Classify every asset in parallel; each iteration only writes its own entry
+	// Traced as one scope: an event per asset would cost more than the classification itself.
 	{
-		Patterns.Reset();
-		Patterns.Reserve(6);
-		LastPrefix = CurrentPrefix;
-		LastSourcePrefix = TargetSourcePrefix;
+		MIRENAMER_TRACE_SCOPE(Classify);
+		ParallelFor(TEXT("MaterialInstanceRenamer.Classify"), Assets.Num(), ClassifyMinBatchSize, [&Assets, &FindRules, &Plan, &NewAssetNames](int32 AssetIndex)
+		{
+			const FAssetData& Asset = Assets[AssetIndex];
+			FRenamePlanEntry& Entry = Plan.Entries[AssetIndex];
+			Entry.OldObjectPath = Asset.GetSoftObjectPath();
+
+			const FRenameRuleSet* Rules = FindRules(Asset);
+			if (!Rules)
+			{
+				Entry.Result = ERenameResult::Skipped;
+				Entry.Reason = ReasonNoRules;
+				return;
+			}
 
-		// Add patterns for the current custom prefix first, as they are most specific.
-		Patterns.Emplace(CurrentPrefix + TargetSourcePrefix, TEXT("_Inst"));
-		Patterns.Emplace(CurrentPrefix + TargetSourcePrefix, TEXT(""));
+			// Classify from a stack copy of the name; only a rename allocates (the new name).
+			const FNameBuilder AssetName(Asset.AssetName);
+			Entry.Result = Rules->Classify(AssetName.ToView(), NewAssetNames[AssetIndex]);
+
+			switch (Entry.Result)
+			{
+			case ERenameResult::Skipped:
+				Entry.Reason = ReasonHasPrefix;
+				break;
+			case ERenameResult::InvalidPattern:
+				Entry.Reason = ReasonNoPattern;
+				break;
+			default:
+				Entry.Reason = ReasonWillRename;
+				break;
+			}
+		});
+	}
 
-		// Add patterns for the legacy "MI_" prefix to allow cleanup of old assets,
-		// but only if the custom prefix is not the same.
-		if (CurrentPrefix != TEXT("MI_"))
+	TArray<int32> PendingEntryIndices;
+	TSet<FName> PendingPackagePaths;
+	for (int32 EntryIndex = 0; EntryIndex < Plan.Entries.Num(); ++EntryIndex)
+	{
+		if (Plan.Entries[EntryIndex].Result == ERenameResult::Renamed)
 		{
-			Patterns.Emplace(TEXT("MI_") + TargetSourcePrefix, TEXT("_Inst"));
-			Patterns.Emplace(TEXT("MI_") + TargetSourcePrefix, TEXT(""));
+			PendingEntryIndices.Add(EntryIndex);
+			PendingPackagePaths.Add(Assets[EntryIndex].PackagePath);
 		}
+	}
+
+	// Only a rename builds a new name; every other asset is classified from its name in a stack buffer.
+	Plan.NumNewNames = Algo::CountIf(NewAssetNames, [](const FString& NewAssetName) { return !NewAssetName.IsEmpty(); });
+	Plan.NumNamesKept = Assets.Num() - Plan.NumNewNames;
+	NumNamesKeptTotal.fetch_add(Plan.NumNamesKept, std::memory_order_relaxed);
 
-		// Add general patterns
-		Patterns.Emplace(TargetSourcePrefix, TEXT("_Inst"));
-		Patterns.Emplace(TargetSourcePrefix, TEXT(""));
-		Patterns.Emplace(TEXT(""), TEXT("_Inst"));
+	if (PendingEntryIndices.IsEmpty())
+	{
+		return Plan;
 	}
 
-	for (const FRenamePattern& Pattern : Patterns)
+	// 2. Index the names that already exist in the affected folders, once for the whole run
+	// Queried through the registry singleton rather than the module manager, so planning can run on any thread.
 	{
-		bool bPrefixMatches = Pattern.Prefix.IsEmpty() || OldAssetName.StartsWith(Pattern.Prefix);
-		bool bSuffixMatches = Pattern.Suffix.IsEmpty() || OldAssetName.EndsWith(Pattern.Suffix);
+		MIRENAMER_TRACE_SCOPE(IndexNames);
+		NameIndex.AddPackagePaths(IAssetRegistry::GetChecked(), PendingPackagePaths.Array());
+	}
+
+	MIRENAMER_TRACE_SCOPE(ResolveCollisions);
 
-		if (bPrefixMatches && bSuffixMatches)
+	// 3. Resolve collisions in a stable order so the dry run and the real run agree on suffixes
+	Algo::Sort(PendingEntryIndices, [&Assets](int32 A, int32 B)
+	{
+		return Assets[A].PackageName.Compare(Assets[B].PackageName) < 0;
+	});
+
+	for (const int32 EntryIndex : PendingEntryIndices)
+	{
+		const FAssetData& Asset = Assets[EntryIndex];
+		const FName UniqueAssetName = NameIndex.ReserveUniqueName(Asset.PackagePath, NewAssetNames[EntryIndex]);
+
+		TStringBuilder<FName::StringBufferSize> NewPackageName;
+		NewPackageName << Asset.PackagePath << TEXT('/') << UniqueAssetName;
+		Plan.Entries[EntryIndex].NewObjectPath = FSoftObjectPath(FTopLevelAssetPath(FName(NewPackageName.ToView()), UniqueAssetName));
+	}
+
+	return Plan;
+}
+
+// Orders the planned renames so that the renames of each referencer are contiguous
+void FAssetRenameUtil::GroupRenamesByReferencers(FRenamePlan& Plan, int32 BatchSize)
+{
+	MIRENAMER_TRACE_SCOPE(GroupByReferencers);
+
+	BatchSize = FMath::Max(1, BatchSize);
+	Plan.ReferencerFanout = FReferencerFanout();
+
+	TArray<int32> RenameEntryIndices;
+	for (int32 EntryIndex = 0; EntryIndex < Plan.Entries.Num(); ++EntryIndex)
+	{
+		if (Plan.Entries[EntryIndex].Result == ERenameResult::Renamed)
 		{
-			int32 End = OldAssetName.Len() - Pattern.SuffixLen;
-			OutBaseName = OldAssetName.Mid(Pattern.PrefixLen, End - Pattern.PrefixLen);
-			return true;
+			RenameEntryIndices.Add(EntryIndex);
 		}
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("Asset '%s' does not match any expected naming pattern."), *OldAssetName);
-	return false; // No pattern matched
+	if (RenameEntryIndices.IsEmpty())
+	{
+		return;
+	}
+
+	// 1. Build the rename -> referencer graph. Renames are identified by their index in RenameEntryIndices.
+	IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+	TMap<FName, int32> ReferencerIndices;
+	TArray<FName> ReferencerNames;
+	TArray<TArray<int32>> RenamesOfReferencer;
+	TArray<FName> Referencers;
+	for (int32 RenameIndex = 0; RenameIndex < RenameEntryIndices.Num(); ++RenameIndex)
+	{
+		FRenamePlanEntry& Entry = Plan.Entries[RenameEntryIndices[RenameIndex]];
+		const FName PackageName = Entry.OldObjectPath.GetLongPackageFName();
+
+		Referencers.Reset();
+		AssetRegistry.GetReferencers(PackageName, Referencers);
+		for (const FName Referencer : Referencers)
+		{
+			if (Referencer == PackageName)
+			{
+				continue;
+			}
+
+			int32& ReferencerIndex = ReferencerIndices.FindOrAdd(Referencer, INDEX_NONE);
+			if (ReferencerIndex == INDEX_NONE)
+			{
+				ReferencerIndex = ReferencerNames.Add(Referencer);
+				RenamesOfReferencer.AddDefaulted();
+			}
+			RenamesOfReferencer[ReferencerIndex].Add(RenameIndex);
+			Entry.NumReferencers++;
+		}
+	}
+
+	// Counts, for every referencer, the distinct batches that rename one of its references
+	auto EstimateReferencerLoads = [&RenamesOfReferencer, BatchSize](TConstArrayView<int32> EntryPositions)
+	{
+		int32 NumLoads = 0;
+		TArray<int32> Batches;
+		for (const TArray<int32>& Renames : RenamesOfReferencer)
+		{
+			Batches.Reset();
+			for (const int32 RenameIndex : Renames)
+			{
+				Batches.AddUnique(EntryPositions[RenameIndex] / BatchSize);
+			}
+			NumLoads += Batches.Num();
+		}
+		return NumLoads;
+	};
+
+	Plan.ReferencerFanout.EstimatedLoadsBefore = EstimateReferencerLoads(RenameEntryIndices);
+
+	// 2. Visit referencers heaviest first and place their renames next to each other
+	TArray<int32> ReferencerOrder;
+	ReferencerOrder.Reserve(ReferencerNames.Num());
+	for (int32 ReferencerIndex = 0; ReferencerIndex < ReferencerNames.Num(); ++ReferencerIndex)
+	{
+		ReferencerOrder.Add(ReferencerIndex);
+	}
+	Algo::Sort(ReferencerOrder, [&RenamesOfReferencer, &ReferencerNames](int32 A, int32 B)
+	{
+		if (RenamesOfReferencer[A].Num() != RenamesOfReferencer[B].Num())
+		{
+			return RenamesOfReferencer[A].Num() > RenamesOfReferencer[B].Num();
+		}
+		return ReferencerNames[A].Compare(ReferencerNames[B]) < 0;
+	});
+
+	// Package name order inside a run keeps the result independent of the registry's enumeration order.
+	auto ByPackageName = [&Plan, &RenameEntryIndices](int32 A, int32 B)
+	{
+		return Plan.Entries[RenameEntryIndices[A]].OldObjectPath.GetLongPackageFName().Compare(Plan.Entries[RenameEntryIndices[B]].OldObjectPath.GetLongPackageFName()) < 0;
+	};
+
+	TArray<int32> RenameOrder;
+	RenameOrder.Reserve(RenameEntryIndices.Num());
+	TBitArray<> Placed(false, RenameEntryIndices.Num());
+	TArray<int32> Run;
+	for (const int32 ReferencerIndex : ReferencerOrder)
+	{
+		Run.Reset();
+		for (const int32 RenameIndex : RenamesOfReferencer[ReferencerIndex])
+		{
+			if (!Placed[RenameIndex])
+			{
+				Placed[RenameIndex] = true;
+				Run.Add(RenameIndex);
+			}
+		}
+		Algo::Sort(Run, ByPackageName);
+		RenameOrder.Append(Run);
+	}
+
+	for (int32 RenameIndex = 0; RenameIndex < RenameEntryIndices.Num(); ++RenameIndex)
+	{
+		if (!Placed[RenameIndex])
+		{
+			RenameOrder.Add(RenameIndex);
+		}
+	}
+
+	// 3. Rebuild the entries: grouped renames first, then everything that is not renamed, in its original order
+	TArray<int32> EntryPositions;
+	EntryPositions.SetNumUninitialized(RenameEntryIndices.Num());
+	TArray<FRenamePlanEntry> OrderedEntries;
+	OrderedEntries.Reserve(Plan.Entries.Num());
+	for (const int32 RenameIndex : RenameOrder)
+	{
+		EntryPositions[RenameIndex] = OrderedEntries.Add(MoveTemp(Plan.Entries[RenameEntryIndices[RenameIndex]]));
+	}
+	for (FRenamePlanEntry& Entry : Plan.Entries)
+	{
+		if (Entry.Result != ERenameResult::Renamed)
+		{
+			OrderedEntries.Add(MoveTemp(Entry));
+		}
+	}
+	Plan.Entries = MoveTemp(OrderedEntries);
+
+	FReferencerFanout& Fanout = Plan.ReferencerFanout;
+	Fanout.NumReferencers = ReferencerNames.Num();
+	for (const TArray<int32>& Renames : RenamesOfReferencer)
+	{
+		Fanout.NumReferences += Renames.Num();
+	}
+	if (!ReferencerOrder.IsEmpty())
+	{
+		Fanout.HeaviestReferencer = ReferencerNames[ReferencerOrder[0]];
+		Fanout.HeaviestReferencerFanout = RenamesOfReferencer[ReferencerOrder[0]].Num();
+	}
+	Fanout.EstimatedLoadsAfter = EstimateReferencerLoads(EntryPositions);
 }
 
-// Main function to orchestrate the renaming process
-ERenameResult FAssetRenameUtil::RenameMaterialInstance(const FAssetData& SelectedAsset, FString& OutNewName)
+// Counts renames, referencers and their sizes from registry data
+FRenameImpactEstimate FAssetRenameUtil::EstimateImpact(const FRenamePlan& Plan)
 {
-	const UMaterialInstanceRenamerSettings* Settings = GetDefault<UMaterialInstanceRenamerSettings>();
-	const FString& RecommendedPrefix = Settings->RenamePrefix;
-	FString OldAssetName = SelectedAsset.AssetName.ToString();
+	MIRENAMER_TRACE_SCOPE(EstimateImpact);
 
-	// 1. Check if the asset should be skipped
-	// The MI_M_ prefix is a special case for cleaning up material-prefixed instances.
-	if (OldAssetName.StartsWith(RecommendedPrefix) && !OldAssetName.StartsWith(TEXT("MI_M_")))
+	IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+	auto GetDiskSize = [&AssetRegistry](FName PackageName) -> int64
 	{
-		UE_LOG(LogTemp, Log, TEXT("Skipped rename for '%s' as it already has the recommended prefix."), *OldAssetName);
-		return ERenameResult::Skipped;
-	}
+		const TOptional<FAssetPackageData> PackageData = AssetRegistry.GetAssetPackageDataCopy(PackageName);
+		return PackageData.IsSet() ? FMath::Max<int64>(0, PackageData->DiskSize) : 0;
+	};
 
-	// 2. Extract the base name using the rule-based method
-	FString BaseName;
-	if (!ExtractBaseName(OldAssetName, BaseName))
+	FRenameImpactEstimate Estimate;
+	TSet<FName> RenamedPackages;
+	for (const FRenamePlanEntry& Entry : Plan.Entries)
 	{
-		return ERenameResult::InvalidPattern;
+		if (Entry.Result == ERenameResult::Renamed)
+		{
+			const FName PackageName = Entry.OldObjectPath.GetLongPackageFName();
+			RenamedPackages.Add(PackageName);
+			Estimate.RenamedBytes += GetDiskSize(PackageName);
+		}
 	}
+	Estimate.NumRenames = RenamedPackages.Num();
 
-	// 3. Construct the new name and perform the rename
-	FString NewAssetName = RecommendedPrefix + BaseName;
-	if (RenameAsset(SelectedAsset, NewAssetName, OutNewName))
+	// A renamed Material Instance that references another one is already counted as a rename.
+	TSet<FName> ReferencerPackages;
+	TArray<FName> Referencers;
+	for (const FName PackageName : RenamedPackages)
 	{
-		return ERenameResult::Renamed;
+		Referencers.Reset();
+		AssetRegistry.GetReferencers(PackageName, Referencers);
+		for (const FName Referencer : Referencers)
+		{
+			bool bAlreadyCounted = false;
+			if (!RenamedPackages.Contains(Referencer))
+			{
+				ReferencerPackages.Add(Referencer, &bAlreadyCounted);
+				if (!bAlreadyCounted)
+				{
+					Estimate.ReferencerBytes += GetDiskSize(Referencer);
+				}
+			}
+		}
 	}
+	Estimate.NumReferencers = ReferencerPackages.Num();
 
-	return ERenameResult::Failed;
+	return Estimate;
 }
 
-// Performs the actual asset rename using the AssetTools module.
-bool FAssetRenameUtil::RenameAsset(const FAssetData& AssetToRename, const FString& NewName, FString& OutNewName)
+int64 FAssetRenameUtil::GetNumNamesKept()
 {
+	return AssetRenameUtil_Private::NumNamesKeptTotal.load(std::memory_order_relaxed);
+}
+
+// Executes the planned renames in chunks, one IAssetTools::RenameAssets call per chunk
+bool FAssetRenameUtil::ExecuteRenamePlan(TConstArrayView<FRenamePlanEntry> Entries, TArray<FRenameOutcome>& OutOutcomes, const FRenameBatchOptions& Options)
+{
+	using namespace AssetRenameUtil_Private;
+
+	// Renaming mutates UObjects and packages, which is only allowed on the game thread.
+	check(IsInGameThread());
+	MIRENAMER_TRACE_SCOPE(ExecuteRenamePlan);
+
+	OutOutcomes.Reset(Entries.Num());
+
 	FAssetToolsModule& AssetToolsModule = FModuleManager::LoadModuleChecked<FAssetToolsModule>("AssetTools");
 	IAssetTools& AssetTools = AssetToolsModule.Get();
 
-	FString CurrentPackagePath = AssetToRename.PackagePath.ToString();
-	FString BaseAssetName = FPaths::Combine(CurrentPackagePath, NewName);
+	const int32 BatchSize = FMath::Max(1, Options.BatchSize);
 
-	FString UniquePackageName;
-	FString UniqueAssetName;
-	AssetTools.CreateUniqueAssetName(BaseAssetName, TEXT(""), UniquePackageName, UniqueAssetName);
+	TArray<FAssetRenameData> AssetsToRenameData;
+	TArray<int32> PendingOutcomeIndices;
+	AssetsToRenameData.Reserve(FMath::Min(BatchSize, Entries.Num()));
+	PendingOutcomeIndices.Reserve(FMath::Min(BatchSize, Entries.Num()));
 
-	UObject* AssetObject = AssetToRename.GetAsset();
-	if (!AssetObject)
+	for (int32 BatchStart = 0; BatchStart < Entries.Num(); BatchStart += BatchSize)
 	{
-		UE_LOG(LogTemp, Error, TEXT("Failed to load asset '%s' for renaming."), *AssetToRename.GetObjectPathString());
-		return false;
+		const int32 BatchEnd = FMath::Min(BatchStart + BatchSize, Entries.Num());
+		AssetsToRenameData.Reset();
+		PendingOutcomeIndices.Reset();
+
+		// 1. Load the assets of the chunk that are planned for renaming
+		for (int32 EntryIndex = BatchStart; EntryIndex < BatchEnd; ++EntryIndex)
+		{
+			const FRenamePlanEntry& Entry = Entries[EntryIndex];
+			FRenameOutcome& Outcome = OutOutcomes.AddDefaulted_GetRef();
+			Outcome.OldObjectPath = Entry.OldObjectPath;
+			Outcome.Result = Entry.Result;
+			Outcome.Reason = Entry.Reason;
+
+			if (Entry.Result != ERenameResult::Renamed)
+			{
+				continue;
+			}
+
+			const double LoadStartTime = FPlatformTime::Seconds();
+			UObject* AssetObject = LoadAssetForRename(Entry.OldObjectPath);
+			Outcome.LoadSeconds = FPlatformTime::Seconds() - LoadStartTime;
+			if (!AssetObject)
+			{
+				UE_LOG(LogTemp, Error, TEXT("Failed to load asset '%s' for renaming."), *Entry.OldObjectPath.ToString());
+				Outcome.Result = ERenameResult::Failed;
+				Outcome.Reason = ReasonLoadFailed;
+				continue;
+			}
+
+			Outcome.NewName = Entry.NewObjectPath.GetAssetName();
+			AssetsToRenameData.Emplace(AssetObject, FPackageName::GetLongPackagePath(Entry.NewObjectPath.GetLongPackageName()), Outcome.NewName);
+			PendingOutcomeIndices.Add(OutOutcomes.Num() - 1);
+		}
+
+		// 2. Submit the whole chunk at once so shared referencers are fixed up a single time
+		if (!AssetsToRenameData.IsEmpty())
+		{
+			// Check out the renamed packages and their referencers together, so AssetTools finds them writable.
+			// If that fails, later batches would fail the same way, so the run stops here without renaming.
+			if (Options.bBulkCheckOut && FRenameSourceControl::IsActive()
+				&& !FRenameSourceControl::CheckOutPackages(FRenameSourceControl::GatherBatchPackages(Entries.Slice(BatchStart, BatchEnd - BatchStart)).PackagesToCheckOut))
+			{
+				for (const int32 OutcomeIndex : PendingOutcomeIndices)
+				{
+					FRenameOutcome& Outcome = OutOutcomes[OutcomeIndex];
+					Outcome.NewName.Reset();
+					Outcome.Result = ERenameResult::Failed;
+					Outcome.Reason = ReasonCheckOutFailed;
+				}
+				UE_LOG(LogTemp, Error, TEXT("Stopping the rename: the packages of %d assets could not be checked out."), PendingOutcomeIndices.Num());
+				return false;
+			}
+
+			// Count every package that turns dirty during the call: the renamed packages, their redirectors
+			// and the referencers that get fixed up.
+			TSet<const UPackage*> DirtiedPackages;
+			const FDelegateHandle DirtyHandle = UPackage::PackageMarkedDirtyEvent.AddLambda([&DirtiedPackages](UPackage* Package, bool bWasDirty)
+			{
+				if (!bWasDirty)
+				{
+					DirtiedPackages.Add(Package);
+				}
+			});
+
+			const double RenameStartTime = FPlatformTime::Seconds();
+			{
+				// AssetTools' own scopes for referencer fix-up and redirector creation nest under this one.
+				MIRENAMER_TRACE_SCOPE(RenameAssets);
+				AssetTools.RenameAssets(AssetsToRenameData);
+			}
+			const double RenameSeconds = FPlatformTime::Seconds() - RenameStartTime;
+			const double RenameSecondsPerAsset = RenameSeconds / AssetsToRenameData.Num();
+			UPackage::PackageMarkedDirtyEvent.Remove(DirtyHandle);
+
+			TRACE_COUNTER_ADD(MIRenamer_PackagesDirtied, DirtiedPackages.Num());
+			INC_DWORD_STAT_BY(STAT_MIRenamer_PackagesDirtied, DirtiedPackages.Num());
+			SET_FLOAT_STAT(STAT_MIRenamer_AssetsPerSecond, RenameSeconds > 0.0 ? AssetsToRenameData.Num() / RenameSeconds : 0.0);
+
+			// RenameAssets only reports success for the chunk as a whole, so verify each asset individually.
+			for (int32 PendingIndex = 0; PendingIndex < AssetsToRenameData.Num(); ++PendingIndex)
+			{
+				const FAssetRenameData& RenameData = AssetsToRenameData[PendingIndex];
+				FRenameOutcome& Outcome = OutOutcomes[PendingOutcomeIndices[PendingIndex]];
+				Outcome.RenameSeconds = RenameSecondsPerAsset;
+
+				const UObject* RenamedObject = RenameData.Asset.Get();
+				if (RenamedObject && RenamedObject->GetName() == RenameData.NewName && RenamedObject->GetPackage()->GetName() == FPaths::Combine(RenameData.NewPackagePath, RenameData.NewName))
+				{
+					UE_LOG(LogTemp, Log, TEXT("Successfully renamed '%s' to '%s'"), *Outcome.OldObjectPath.GetAssetName(), *Outcome.NewName);
+					Outcome.Reason = ReasonRenamed;
+					TRACE_COUNTER_INCREMENT(MIRenamer_AssetsRenamed);
+					INC_DWORD_STAT(STAT_MIRenamer_AssetsRenamed);
+				}
+				else
+				{
+					UE_LOG(LogTemp, Error, TEXT("Failed to rename asset '%s' to '%s' using AssetTools."), *Outcome.OldObjectPath.GetAssetName(), *RenameData.NewName);
+					Outcome.NewName.Reset();
+					Outcome.Result = ERenameResult::Failed;
+					Outcome.Reason = ReasonRenameFailed;
+				}
+			}
+		}
+
+		if (Options.OnBatchCompleted && !Options.OnBatchCompleted(BatchEnd, Entries.Num()))
+		{
+			break;
+		}
 	}
 
-	TArray<FAssetRenameData> AssetsToRenameData;
-	AssetsToRenameData.Emplace(AssetObject, FPaths::GetPath(UniquePackageName), UniqueAssetName);
+	return true;
+}
 
-	if (AssetTools.RenameAssets(AssetsToRenameData))
+// Fixes up the referencers of the redirectors at the old paths in one pass
+FRedirectorFixupResult FAssetRenameUtil::FixupRedirectors(TConstArrayView<FSoftObjectPath> OldObjectPaths, bool bPromptForCheckout)
+{
+	check(IsInGameThread());
+	MIRENAMER_TRACE_SCOPE(FixupRedirectors);
+
+	FRedirectorFixupResult Result;
+
+	TArray<UObjectRedirector*> Redirectors;
+	Redirectors.Reserve(OldObjectPaths.Num());
+	for (const FSoftObjectPath& OldObjectPath : OldObjectPaths)
 	{
-		UE_LOG(LogTemp, Log, TEXT("Successfully renamed '%s' to '%s'"), *AssetToRename.AssetName.ToString(), *UniqueAssetName);
-		OutNewName = UniqueAssetName;
-		return true;
+		const FString ObjectPath = OldObjectPath.ToString();
+		UObjectRedirector* Redirector = FindObject<UObjectRedirector>(nullptr, *ObjectPath);
+		if (!Redirector && FPackageName::DoesPackageExist(OldObjectPath.GetLongPackageName()))
+		{
+			Redirector = LoadObject<UObjectRedirector>(nullptr, *ObjectPath, nullptr, LOAD_NoWarn | LOAD_Quiet);
+		}
+
+		if (Redirector)
+		{
+			Redirectors.Add(Redirector);
+		}
 	}
 
-	UE_LOG(LogTemp, Error, TEXT("Failed to rename asset '%s' to '%s' using AssetTools."), *AssetToRename.AssetName.ToString(), *UniqueAssetName);
-	return false;
+	Result.NumRedirectors = Redirectors.Num();
+	if (Redirectors.IsEmpty())
+	{
+		return Result;
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("Fixing up referencers of %d redirectors..."), Redirectors.Num());
+	TArray<FString> RedirectorPackageNames;
+	RedirectorPackageNames.Reserve(Redirectors.Num());
+	for (const UObjectRedirector* Redirector : Redirectors)
+	{
+		RedirectorPackageNames.Add(Redirector->GetOutermost()->GetName());
+	}
+
+	IAssetTools& AssetTools = FModuleManager::LoadModuleChecked<FAssetToolsModule>("AssetTools").Get();
+	AssetTools.FixupReferencers(Redirectors, bPromptForCheckout, ERedirectFixupMode::DeleteFixedUpRedirectors);
+
+	// AssetTools keeps redirectors that are still referenced (e.g. by a package it could not check out or save).
+	for (const FString& PackageName : RedirectorPackageNames)
+	{
+		if (!FPackageName::DoesPackageExist(PackageName))
+		{
+			Result.NumDeleted++;
+		}
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("Deleted %d of %d redirectors; %d are still referenced."), Result.NumDeleted, Result.NumRedirectors, Result.NumRedirectors - Result.NumDeleted);
+	return Result;
 }
@@ -0,0 +1,226 @@
+// Copyright 2026 kurorekish. All Rights Reserved.
+
+#include "FRenameJournal.h"
+#include "FRenameReport.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/PackageName.h"
+#include "HAL/FileManager.h"
+#include "Containers/BitArray.h"
+
+namespace RenameJournal_Private
+{
+	// First field of the header line
+	static const TCHAR* const Magic = TEXT("MIRenamerJournal");
+
+	// Bumped whenever the file layout changes
+	static constexpr int32 Version = 1;
+
+	// Reason of an interrupted entry whose save reached the disk
+	static const TCHAR* const ReasonRecovered = TEXT("Renamed before the previous run was interrupted");
+
+	// Plan entry reasons must outlive the plan. Moving an FString keeps its buffer, so the pointers stay valid.
+	static const TCHAR* InternReason(const FString& Reason)
+	{
+		static TSet<FString> Reasons;
+		return *Reasons.FindOrAdd(Reason);
+	}
+}
+
+bool FRenameJournal::Begin(const FString& InFilename, const FRunKey& InKey, const FRenamePlan& Plan)
+{
+	using namespace RenameJournal_Private;
+
+	Filename = InFilename;
+	NumCommitted = 0;
+	NumRecovered = 0;
+	NumRetried = 0;
+
+	FString Contents;
+	Contents.Reserve((Plan.Num() + 1) * 160);
+	Contents.Appendf(TEXT("%s\t%d\t%08x\t%d\t%d\t%s\n"), Magic, Version, InKey.RulesFingerprint, InKey.Shard, InKey.NumShards, *InKey.Path);
+
+	// Plan entries: P, OldObjectPath, NewObjectPath, Result, NumReferencers, Reason
+	TStringBuilder<512> Line;
+	for (const FRenamePlanEntry& Entry : Plan.GetEntries())
+	{
+		Line.Reset();
+		Line << TEXT("P\t") << Entry.OldObjectPath.ToString() << TEXT('\t');
+		if (Entry.Result == ERenameResult::Renamed)
+		{
+			Line << Entry.NewObjectPath.ToString();
+		}
+		Line << TEXT('\t') << FRenameReport::ResultToString(Entry.Result) << TEXT('\t') << Entry.NumReferencers << TEXT('\t') << Entry.Reason << TEXT('\n');
+		Contents.Append(Line.ToView());
+	}
+
+	const FString TempFilename = Filename + TEXT(".tmp");
+	IFileManager::Get().MakeDirectory(*FPaths::GetPath(Filename), true);
+	if (!FFileHelper::SaveStringToFile(Contents, *TempFilename, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM)
+		|| !IFileManager::Get().Move(*Filename, *TempFilename, true))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to write journal %s."), *Filename);
+		return false;
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("Started journal %s with %d planned entries."), *Filename, Plan.Num());
+	return true;
+}
+
+bool FRenameJournal::Load(const FString& InFilename, const FRunKey& InKey, FRenamePlan& OutRemaining)
+{
+	using namespace RenameJournal_Private;
+
+	Filename = InFilename;
+	NumCommitted = 0;
+	NumRecovered = 0;
+	NumRetried = 0;
+
+	TArray<FString> Lines;
+	if (!FPaths::FileExists(Filename) || !FFileHelper::LoadFileToStringArray(Lines, *Filename) || Lines.IsEmpty())
+	{
+		UE_LOG(LogTemp, Error, TEXT("No journal found at %s. Nothing can be resumed."), *Filename);
+		return false;
+	}
+
+	// Header: Magic, Version, RulesFingerprint, Shard, NumShards, Path
+	TArray<FString> Fields;
+	Lines[0].ParseIntoArray(Fields, TEXT("\t"), false);
+	if (Fields.Num() != 6 || Fields[0] != Magic || FCString::Atoi(*Fields[1]) != Version)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Journal %s has an unknown format."), *Filename);
+		return false;
+	}
+
+	if (FCString::Strtoui64(*Fields[2], nullptr, 16) != InKey.RulesFingerprint)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Naming rules changed since journal %s was written. Start a new run without -Resume."), *Filename);
+		return false;
+	}
+
+	if (FCString::Atoi(*Fields[3]) != InKey.Shard || FCString::Atoi(*Fields[4]) != InKey.NumShards || !Fields[5].Equals(InKey.Path, ESearchCase::IgnoreCase))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Journal %s was written for -Path=%s -Shard=%s -NumShards=%s. Resume with the same arguments."),
+			*Filename, *Fields[5], *Fields[3], *Fields[4]);
+		return false;
+	}
+
+	TArray<FRenamePlanEntry> Entries;
+	Entries.Reserve(Lines.Num() - 1);
+	TBitArray<> Begun;
+	TBitArray<> Committed;
+	TBitArray<> Failed;
+	bool bFinished = false;
+
+	for (int32 LineIndex = 1; LineIndex < Lines.Num(); ++LineIndex)
+	{
+		Lines[LineIndex].ParseIntoArray(Fields, TEXT("\t"), false);
+		if (Fields.IsEmpty())
+		{
+			continue;
+		}
+
+		if (Fields[0] == TEXT("P") && Fields.Num() == 6)
+		{
+			FRenamePlanEntry& Entry = Entries.AddDefaulted_GetRef();
+			Entry.OldObjectPath = FSoftObjectPath(Fields[1]);
+			Entry.NewObjectPath = Fields[2].IsEmpty() ? FSoftObjectPath() : FSoftObjectPath(Fields[2]);
+			FRenameReport::ResultFromString(Fields[3], Entry.Result);
+			Entry.NumReferencers = FCString::Atoi(*Fields[4]);
+			Entry.Reason = InternReason(Fields[5]);
+			Begun.Add(false);
+			Committed.Add(false);
+			Failed.Add(false);
+		}
+		else if ((Fields[0] == TEXT("W") || Fields[0] == TEXT("C") || Fields[0] == TEXT("F")) && Fields.Num() == 3)
+		{
+			const int32 Start = FMath::Clamp(FCString::Atoi(*Fields[1]), 0, Entries.Num());
+			const int32 End = FMath::Clamp(FCString::Atoi(*Fields[2]), Start, Entries.Num());
+			(Fields[0] == TEXT("W") ? Begun : Fields[0] == TEXT("C") ? Committed : Failed).SetRange(Start, End - Start, true);
+		}
+		else if (Fields[0] == TEXT("E"))
+		{
+			bFinished = true;
+		}
+		// A record cut short by a crash is ignored; it can only be the last line.
+	}
+
+	TArray<FRenamePlanEntry> Remaining;
+	if (!bFinished)
+	{
+		for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); ++EntryIndex)
+		{
+			if (Committed[EntryIndex])
+			{
+				NumCommitted++;
+				continue;
+			}
+
+			// A failed entry was attempted and left in place, so it is simply executed again.
+			FRenamePlanEntry& Entry = Entries[EntryIndex];
+			if (Failed[EntryIndex])
+			{
+				NumRetried++;
+			}
+			// A window that was begun but not committed may have been partly saved. A rename whose new package is on disk is not repeated.
+			else if (Begun[EntryIndex] && Entry.Result == ERenameResult::Renamed
+				&& FPackageName::DoesPackageExist(Entry.NewObjectPath.GetLongPackageName()))
+			{
+				UE_LOG(LogTemp, Warning, TEXT("%s was renamed to %s before the previous run was interrupted. Check its referencers."),
+					*Entry.OldObjectPath.ToString(), *Entry.NewObjectPath.ToString());
+				Entry.Result = ERenameResult::Skipped;
+				Entry.Reason = ReasonRecovered;
+				NumRecovered++;
+			}
+			Remaining.Add(MoveTemp(Entry));
+		}
+	}
+	else
+	{
+		NumCommitted = Entries.Num();
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("Loaded journal %s: %d planned entries, %d committed, %d remaining (%d failed before and retried, %d recovered from interrupted windows)."),
+		*Filename, Entries.Num(), NumCommitted, Remaining.Num(), NumRetried, NumRecovered);
+
+	OutRemaining = FRenamePlan::FromEntries(MoveTemp(Remaining));
+	return true;
+}
+
+bool FRenameJournal::BeginWindow(int32 Start, int32 End)
+{
+	return Append(WriteToString<64>(TEXT("W\t"), Start, TEXT('\t'), End, TEXT('\n')));
+}
+
+bool FRenameJournal::CommitWindow(int32 Start, TConstArrayView<FRenameOutcome> Outcomes)
+{
+	// One record per run of entries with the same state: C for committed, F for failed and retried on resume.
+	TStringBuilder<256> Records;
+	int32 RunStart = 0;
+	for (int32 Index = 1; Index <= Outcomes.Num(); ++Index)
+	{
+		const bool bRunFailed = Outcomes[RunStart].Result == ERenameResult::Failed;
+		if (Index == Outcomes.Num() || (Outcomes[Index].Result == ERenameResult::Failed) != bRunFailed)
+		{
+			Records << (bRunFailed ? TEXT("F\t") : TEXT("C\t")) << Start + RunStart << TEXT('\t') << Start + Index << TEXT('\n');
+			RunStart = Index;
+		}
+	}
+	return Outcomes.IsEmpty() || Append(Records.ToView());
+}
+
+bool FRenameJournal::Finish()
+{
+	return Append(TEXTVIEW("E\n"));
+}
+
+bool FRenameJournal::Append(FStringView Record) const
+{
+	// Opened and closed per record, so every record is on disk before the run moves on.
+	if (!FFileHelper::SaveStringToFile(Record, *Filename, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM, &IFileManager::Get(), FILEWRITE_Append))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to append to journal %s."), *Filename);
+		return false;
+	}
+	return true;
+}
@@ -0,0 +1,85 @@
+// Copyright 2026 kurorekish. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FAssetRenameUtil.h"
+
+/**
+ * Write-ahead journal of a commandlet run, so an interrupted run can be resumed.
+ *
+ * The journal starts with the whole rename plan, in execution order. Before a window of the plan is renamed
+ * its range is appended as in flight; once the window's packages are saved its entries are appended as committed,
+ * except for the entries that failed, which are appended as failed so that a resumed run retries them.
+ * Every record is appended and the file closed immediately, so a crash loses at most the window in flight.
+ * A resumed run reads the plan back instead of scanning and classifying again, and only executes the entries
+ * that were not committed. Entries of a begun but uncommitted window whose new package already exists on disk
+ * are treated as renamed, because their save reached the disk before the crash.
+ */
+class FRenameJournal
+{
+public:
+	/** Settings of the run a journal was written for. A journal is only resumed by a run with the same settings. */
+	struct FRunKey
+	{
+		uint32 RulesFingerprint = 0;
+		FString Path;
+		int32 Shard = 0;
+		int32 NumShards = 1;
+	};
+
+	/**
+	 * Starts a journal for a plan, replacing any previous journal. The file is written under a temporary name
+	 * and moved into place, so a crash while writing leaves the previous journal intact.
+	 *
+	 * @param InFilename The journal file.
+	 * @param InKey The settings of the run.
+	 * @param Plan The plan about to be executed.
+	 * @return True if the journal was written.
+	 */
+	bool Begin(const FString& InFilename, const FRunKey& InKey, const FRenamePlan& Plan);
+
+	/**
+	 * Reads a journal and rebuilds the entries that still have to be executed.
+	 * Fails if the file is missing, unreadable or was written for different settings.
+	 *
+	 * @param InFilename The journal file.
+	 * @param InKey The settings of the current run.
+	 * @param OutRemaining Receives the plan of the entries that were not committed, in execution order.
+	 * @return True if the journal was read and matches the current settings.
+	 */
+	bool Load(const FString& InFilename, const FRunKey& InKey, FRenamePlan& OutRemaining);
+
+	/** Records that the entries [Start, End) of the plan are about to be renamed. */
+	bool BeginWindow(int32 Start, int32 End);
+
+	/**
+	 * Records the outcomes of a window whose packages were saved. Entries that failed are recorded as failed and are
+	 * executed again by a resumed run; every other entry is committed.
+	 *
+	 * @param Start Index in the plan of the first entry of the window.
+	 * @param Outcomes The outcomes of the entries [Start, Start + Outcomes.Num()), in plan order.
+	 */
+	bool CommitWindow(int32 Start, TConstArrayView<FRenameOutcome> Outcomes);
+
+	/** Records that every entry of the plan was executed. A finished journal has nothing left to resume. */
+	bool Finish();
+
+	/** @return The number of entries of the loaded journal that were committed by previous runs. */
+	int32 GetNumCommitted() const { return NumCommitted; }
+
+	/** @return The number of entries of interrupted windows that were found renamed on disk. */
+	int32 GetNumRecovered() const { return NumRecovered; }
+
+	/** @return The number of entries of the loaded journal that failed in previous runs and are retried. */
+	int32 GetNumRetried() const { return NumRetried; }
+
+private:
+	/** Appends one record to the journal file. */
+	bool Append(FStringView Record) const;
+
+	FString Filename;
+	int32 NumCommitted = 0;
+	int32 NumRecovered = 0;
+	int32 NumRetried = 0;
+};
@@ -0,0 +1,107 @@
+// Copyright 2026 kurorekish. All Rights Reserved.
+
+#include "FRenameManifest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+
+namespace RenameManifest_Private
+{
+	// First field of the header line
+	static const TCHAR* const Magic = TEXT("MIRenamerManifest");
+
+	// Bumped whenever the file layout changes
+	static constexpr int32 Version = 1;
+}
+
+bool FRenameManifest::Load(const FString& Filename, uint32 RulesFingerprint)
+{
+	using namespace RenameManifest_Private;
+
+	Entries.Reset();
+
+	TArray<FString> Lines;
+	if (!FPaths::FileExists(Filename) || !FFileHelper::LoadFileToStringArray(Lines, *Filename) || Lines.IsEmpty())
+	{
+		UE_LOG(LogTemp, Display, TEXT("No manifest found at %s. All packages will be checked."), *Filename);
+		return false;
+	}
+
+	// Header: Magic, Version, RulesFingerprint
+	TArray<FString> Fields;
+	Lines[0].ParseIntoArray(Fields, TEXT("\t"), false);
+	if (Fields.Num() != 3 || Fields[0] != Magic || FCString::Atoi(*Fields[1]) != Version)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Manifest %s has an unknown format and will be rebuilt."), *Filename);
+		return false;
+	}
+
+	if (FCString::Strtoui64(*Fields[2], nullptr, 16) != RulesFingerprint)
+	{
+		UE_LOG(LogTemp, Display, TEXT("Naming rules changed since manifest %s was written. All packages will be checked."), *Filename);
+		return false;
+	}
+
+	// Entries: PackageName, TimestampTicks, Size, State
+	Entries.Reserve(Lines.Num() - 1);
+	for (int32 LineIndex = 1; LineIndex < Lines.Num(); ++LineIndex)
+	{
+		Lines[LineIndex].ParseIntoArray(Fields, TEXT("\t"), false);
+		if (Fields.Num() != 4)
+		{
+			continue;
+		}
+
+		const int32 State = FCString::Atoi(*Fields[3]);
+		if (State < 0 || State > static_cast<int32>(EPackageState::InvalidPattern))
+		{
+			continue;
+		}
+
+		FEntry& Entry = Entries.Add(FName(*Fields[0]));
+		Entry.Timestamp = FDateTime(FCString::Atoi64(*Fields[1]));
+		Entry.Size = FCString::Atoi64(*Fields[2]);
+		Entry.State = static_cast<EPackageState>(State);
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("Loaded manifest %s with %d packages."), *Filename, Entries.Num());
+	return true;
+}
+
+bool FRenameManifest::Save(const FString& Filename, uint32 RulesFingerprint) const
+{
+	using namespace RenameManifest_Private;
+
+	FString Contents;
+	Contents.Reserve((Entries.Num() + 1) * 96);
+	Contents.Appendf(TEXT("%s\t%d\t%08x\n"), Magic, Version, RulesFingerprint);
+
+	TStringBuilder<256> Line;
+	for (const TPair<FName, FEntry>& Pair : Entries)
+	{
+		Line.Reset();
+		Line << Pair.Key << TEXT('\t') << Pair.Value.Timestamp.GetTicks() << TEXT('\t') << Pair.Value.Size << TEXT('\t') << static_cast<int32>(Pair.Value.State) << TEXT('\n');
+		Contents.Append(Line.ToView());
+	}
+
+	IFileManager::Get().MakeDirectory(*FPaths::GetPath(Filename), true);
+	if (!FFileHelper::SaveStringToFile(Contents, *Filename))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to write manifest %s."), *Filename);
+		return false;
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("Wrote manifest %s with %d packages."), *Filename, Entries.Num());
+	return true;
+}
+
+void FRenameManifest::Add(FName PackageName, const FEntry& Entry)
+{
+	Entries.Add(PackageName, Entry);
+}
+
+bool FRenameManifest::IsUpToDate(FName PackageName, const FDateTime& Timestamp, int64 Size) const
+{
+	const FEntry* Entry = Entries.Find(PackageName);
+	return Entry && Entry->Timestamp == Timestamp && Entry->Size == Size;
+}
@@ -0,0 +1,70 @@
+// Copyright 2026 kurorekish. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Persisted record of packages that were already checked by a previous commandlet run.
+ *
+ * Each entry stores a package's file timestamp and size together with its classification result,
+ * so later runs only need to scan and classify packages that are new or modified.
+ * The manifest is tied to the fingerprint of the naming rules it was built with and is discarded
+ * as a whole when the rules change.
+ */
+class FRenameManifest
+{
+public:
+	/** Classification state of a package that does not need to be looked at again while it is unchanged. */
+	enum class EPackageState : uint8
+	{
+		NoHandledAsset,     // The package contains no asset of a handled class.
+		Conforming,         // The asset already follows the naming rules of its class.
+		InvalidPattern,     // The asset does not match any naming pattern of its class.
+	};
+
+	/** A recorded package. */
+	struct FEntry
+	{
+		FDateTime Timestamp;
+		int64 Size = 0;
+		EPackageState State = EPackageState::NoHandledAsset;
+	};
+
+	/**
+	 * Reads a manifest from disk. A missing file, an unknown version or a different rule fingerprint leaves the manifest empty.
+	 *
+	 * @param Filename The manifest file.
+	 * @param RulesFingerprint The fingerprint of the rules used by the current run.
+	 * @return True if the manifest was loaded and is valid for the current rules.
+	 */
+	bool Load(const FString& Filename, uint32 RulesFingerprint);
+
+	/**
+	 * Writes the manifest to disk.
+	 *
+	 * @param Filename The manifest file.
+	 * @param RulesFingerprint The fingerprint of the rules the entries were classified with.
+	 * @return True if the file was written.
+	 */
+	bool Save(const FString& Filename, uint32 RulesFingerprint) const;
+
+	/** Records a package, replacing any previous entry. */
+	void Add(FName PackageName, const FEntry& Entry);
+
+	/** Forgets a package, so the next run checks it again. */
+	void Remove(FName PackageName) { Entries.Remove(PackageName); }
+
+	/** @return The recorded entry for a package, or nullptr. */
+	const FEntry* Find(FName PackageName) const { return Entries.Find(PackageName); }
+
+	/** @return True if the package is recorded with the given file timestamp and size. */
+	bool IsUpToDate(FName PackageName, const FDateTime& Timestamp, int64 Size) const;
+
+	/** @return The number of recorded packages. */
+	int32 Num() const { return Entries.Num(); }
+
+private:
+	/** Recorded packages, keyed by long package name. */
+	TMap<FName, FEntry> Entries;
+};
@@ -0,0 +1,346 @@
+// Copyright 2026 kurorekish. All Rights Reserved.
+
+#include "FRenameReport.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+
+namespace RenameReport_Private
+{
+	// Bumped whenever the file layout changes.
+	static constexpr int32 Version = 1;
+
+	// Phase names in the "Phases" object, in order
+	static const TCHAR* const PhaseNames[] = { TEXT("RegistryScan"), TEXT("Query"), TEXT("Planning"), TEXT("Load"), TEXT("Rename"), TEXT("Save"), TEXT("Total") };
+
+	static double* GetPhaseFields(FRenameReport::FPhaseTimings& Phases, int32 Index)
+	{
+		double* const Fields[] = { &Phases.RegistryScan, &Phases.Query, &Phases.Planning, &Phases.Load, &Phases.Rename, &Phases.Save, &Phases.Total };
+		static_assert(UE_ARRAY_COUNT(Fields) == UE_ARRAY_COUNT(PhaseNames), "Every phase needs a name");
+		return Fields[Index];
+	}
+
+	static double GetPhase(const FRenameReport::FPhaseTimings& Phases, int32 Index)
+	{
+		return *GetPhaseFields(const_cast<FRenameReport::FPhaseTimings&>(Phases), Index);
+	}
+
+	// Quotes a CSV field if it contains a separator, quote or line break
+	static void AppendCsvField(FStringBuilderBase& Builder, FStringView Field)
+	{
+		int32 Unused = 0;
+		if (!Field.FindChar(TEXT(','), Unused) && !Field.FindChar(TEXT('"'), Unused) && !Field.FindChar(TEXT('\n'), Unused))
+		{
+			Builder << Field;
+			return;
+		}
+
+		Builder << TEXT('"');
+		for (const TCHAR Char : Field)
+		{
+			if (Char == TEXT('"'))
+			{
+				Builder << TEXT('"');
+			}
+			Builder << Char;
+		}
+		Builder << TEXT('"');
+	}
+
+	// Where an asset was seen while merging
+	struct FAssetLocation
+	{
+		int32 Shard = 0;
+		const FRenameReport::FEntry* Entry = nullptr;
+	};
+}
+
+const TCHAR* FRenameReport::ResultToString(ERenameResult Result)
+{
+	switch (Result)
+	{
+	case ERenameResult::Renamed: return TEXT("Renamed");
+	case ERenameResult::Skipped: return TEXT("Skipped");
+	case ERenameResult::Failed: return TEXT("Failed");
+	case ERenameResult::InvalidPattern: return TEXT("InvalidPattern");
+	}
+	return TEXT("Failed");
+}
+
+bool FRenameReport::ResultFromString(FStringView String, ERenameResult& OutResult)
+{
+	for (const ERenameResult Result : { ERenameResult::Renamed, ERenameResult::Skipped, ERenameResult::Failed, ERenameResult::InvalidPattern })
+	{
+		if (String.Equals(ResultToString(Result), ESearchCase::IgnoreCase))
+		{
+			OutResult = Result;
+			return true;
+		}
+	}
+	return false;
+}
+
+bool FRenameReport::SaveToFile(const FString& Filename) const
+{
+	using namespace RenameReport_Private;
+
+	IFileManager::Get().MakeDirectory(*FPaths::GetPath(Filename), true);
+
+	// One row per asset. Phase timings only exist in the JSON form.
+	if (FPaths::GetExtension(Filename).Equals(TEXT("csv"), ESearchCase::IgnoreCase))
+	{
+		TStringBuilder<4096> Csv;
+		Csv << TEXT("OldPath,NewPath,Result,Reason,LoadSeconds,RenameSeconds\n");
+		for (const FEntry& Entry : Entries)
+		{
+			AppendCsvField(Csv, Entry.OldObjectPath);
+			Csv << TEXT(',');
+			AppendCsvField(Csv, Entry.NewObjectPath);
+			Csv << TEXT(',') << ResultToString(Entry.Result) << TEXT(',');
+			AppendCsvField(Csv, Entry.Reason);
+			Csv.Appendf(TEXT(",%.6f,%.6f\n"), Entry.LoadSeconds, Entry.RenameSeconds);
+		}
+
+		if (!FFileHelper::SaveStringToFile(Csv.ToView(), *Filename, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+		{
+			UE_LOG(LogTemp, Error, TEXT("Failed to write report %s."), *Filename);
+			return false;
+		}
+
+		UE_LOG(LogTemp, Display, TEXT("Wrote report %s with %d assets."), *Filename, Entries.Num());
+		return true;
+	}
+
+	// Written with a streaming writer; reports of large projects hold hundreds of thousands of entries.
+	FString Json;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+	Writer->WriteObjectStart();
+	Writer->WriteValue(TEXT("Version"), Version);
+	Writer->WriteValue(TEXT("Path"), Path);
+	Writer->WriteValue(TEXT("Shard"), Shard);
+	Writer->WriteValue(TEXT("NumShards"), NumShards);
+	Writer->WriteValue(TEXT("DryRun"), bDryRun);
+
+	Writer->WriteObjectStart(TEXT("Phases"));
+	for (int32 PhaseIndex = 0; PhaseIndex < UE_ARRAY_COUNT(PhaseNames); ++PhaseIndex)
+	{
+		Writer->WriteValue(PhaseNames[PhaseIndex], GetPhase(Phases, PhaseIndex));
+	}
+	Writer->WriteObjectEnd();
+
+	// Renamed assets per second of load and rename time, for tracking throughput across runs
+	const int32 NumRenamed = Algo::CountIf(Entries, [](const FEntry& Entry) { return Entry.Result == ERenameResult::Renamed; });
+	const double ExecuteSeconds = Phases.Load + Phases.Rename;
+	Writer->WriteValue(TEXT("RenamedPerSecond"), ExecuteSeconds > 0.0 ? NumRenamed / ExecuteSeconds : 0.0);
+
+	Writer->WriteObjectStart(TEXT("SavedPackages"));
+	Writer->WriteValue(TEXT("Count"), PackagesSaved);
+	Writer->WriteValue(TEXT("Bytes"), BytesSaved);
+	Writer->WriteValue(TEXT("BytesPerSecond"), Phases.Save > 0.0 ? BytesSaved / Phases.Save : 0.0);
+	Writer->WriteObjectEnd();
+
+	Writer->WriteArrayStart(TEXT("Assets"));
+	for (const FEntry& Entry : Entries)
+	{
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("OldPath"), Entry.OldObjectPath);
+		Writer->WriteValue(TEXT("NewPath"), Entry.NewObjectPath);
+		Writer->WriteValue(TEXT("Result"), ResultToString(Entry.Result));
+		Writer->WriteValue(TEXT("Reason"), Entry.Reason);
+		Writer->WriteValue(TEXT("LoadSeconds"), Entry.LoadSeconds);
+		Writer->WriteValue(TEXT("RenameSeconds"), Entry.RenameSeconds);
+		Writer->WriteValue(TEXT("Referencers"), Entry.NumReferencers);
+		Writer->WriteObjectEnd();
+	}
+	Writer->WriteArrayEnd();
+
+	Writer->WriteObjectEnd();
+	Writer->Close();
+
+	if (!FFileHelper::SaveStringToFile(Json, *Filename, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to write report %s."), *Filename);
+		return false;
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("Wrote report %s with %d assets."), *Filename, Entries.Num());
+	return true;
+}
+
+bool FRenameReport::LoadFromFile(const FString& Filename)
+{
+	using namespace RenameReport_Private;
+
+	FString Json;
+	if (!FFileHelper::LoadFileToString(Json, *Filename))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to read report %s."), *Filename);
+		return false;
+	}
+
+	TSharedPtr<FJsonObject> Root;
+	if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Json), Root) || !Root.IsValid())
+	{
+		UE_LOG(LogTemp, Error, TEXT("Report %s is not valid JSON."), *Filename);
+		return false;
+	}
+
+	const int32 FileVersion = Root->GetIntegerField(TEXT("Version"));
+	if (FileVersion < 1 || FileVersion > Version)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Report %s has an unsupported version."), *Filename);
+		return false;
+	}
+
+	Path = Root->GetStringField(TEXT("Path"));
+	Shard = Root->GetIntegerField(TEXT("Shard"));
+	NumShards = Root->GetIntegerField(TEXT("NumShards"));
+	bDryRun = Root->GetBoolField(TEXT("DryRun"));
+
+	Phases = FPhaseTimings();
+	const TSharedPtr<FJsonObject>* PhasesObject = nullptr;
+	if (Root->TryGetObjectField(TEXT("Phases"), PhasesObject))
+	{
+		for (int32 PhaseIndex = 0; PhaseIndex < UE_ARRAY_COUNT(PhaseNames); ++PhaseIndex)
+		{
+			(*PhasesObject)->TryGetNumberField(PhaseNames[PhaseIndex], *GetPhaseFields(Phases, PhaseIndex));
+		}
+	}
+
+	PackagesSaved = 0;
+	BytesSaved = 0;
+	const TSharedPtr<FJsonObject>* SavedObject = nullptr;
+	if (Root->TryGetObjectField(TEXT("SavedPackages"), SavedObject))
+	{
+		(*SavedObject)->TryGetNumberField(TEXT("Count"), PackagesSaved);
+		(*SavedObject)->TryGetNumberField(TEXT("Bytes"), BytesSaved);
+	}
+
+	Entries.Reset();
+	const TArray<TSharedPtr<FJsonValue>>* Assets = nullptr;
+	if (Root->TryGetArrayField(TEXT("Assets"), Assets))
+	{
+		Entries.Reserve(Assets->Num());
+		for (const TSharedPtr<FJsonValue>& Value : *Assets)
+		{
+			const TSharedPtr<FJsonObject>* Asset = nullptr;
+			if (!Value.IsValid() || !Value->TryGetObject(Asset))
+			{
+				continue;
+			}
+
+			FEntry& Entry = Entries.AddDefaulted_GetRef();
+			Entry.OldObjectPath = (*Asset)->GetStringField(TEXT("OldPath"));
+			Entry.NewObjectPath = (*Asset)->GetStringField(TEXT("NewPath"));
+			Entry.Reason = (*Asset)->GetStringField(TEXT("Reason"));
+			(*Asset)->TryGetNumberField(TEXT("LoadSeconds"), Entry.LoadSeconds);
+			(*Asset)->TryGetNumberField(TEXT("RenameSeconds"), Entry.RenameSeconds);
+			(*Asset)->TryGetNumberField(TEXT("Referencers"), Entry.NumReferencers);
+			if (!ResultFromString((*Asset)->GetStringField(TEXT("Result")), Entry.Result))
+			{
+				UE_LOG(LogTemp, Warning, TEXT("Report %s: unknown result for %s."), *Filename, *Entry.OldObjectPath);
+				Entry.Result = ERenameResult::Failed;
+			}
+		}
+	}
+
+	return true;
+}
+
+bool FRenameReport::Merge(TConstArrayView<FRenameReport> Reports, FRenameReport& OutMerged, TArray<FString>& OutConflicts)
+{
+	using namespace RenameReport_Private;
+
+	OutMerged = FRenameReport();
+	if (!Reports.IsEmpty())
+	{
+		OutMerged.Path = Reports[0].Path;
+		OutMerged.NumShards = Reports[0].NumShards;
+		OutMerged.bDryRun = Reports[0].bDryRun;
+	}
+
+	// The reports must be the complete set of shards of one run; a missing shard would go unnoticed otherwise.
+	TBitArray<> SeenShards(false, FMath::Max(OutMerged.NumShards, 0));
+	for (const FRenameReport& Report : Reports)
+	{
+		if (Report.NumShards != OutMerged.NumShards)
+		{
+			OutConflicts.Add(FString::Printf(TEXT("Shard %d was run with %d shards, but shard %d with %d."), Report.Shard, Report.NumShards, Reports[0].Shard, OutMerged.NumShards));
+		}
+		else if (Report.Shard < 0 || Report.Shard >= Report.NumShards)
+		{
+			OutConflicts.Add(FString::Printf(TEXT("Shard %d is not a shard of a run with %d shards."), Report.Shard, Report.NumShards));
+		}
+		else if (SeenShards[Report.Shard])
+		{
+			OutConflicts.Add(FString::Printf(TEXT("Shard %d appears in more than one report."), Report.Shard));
+		}
+		else
+		{
+			SeenShards[Report.Shard] = true;
+		}
+	}
+	for (int32 ShardIndex = 0; ShardIndex < SeenShards.Num(); ++ShardIndex)
+	{
+		if (!SeenShards[ShardIndex])
+		{
+			OutConflicts.Add(FString::Printf(TEXT("Shard %d of %d has no report."), ShardIndex, OutMerged.NumShards));
+		}
+	}
+
+	// Object paths are case-insensitive, so they are compared in lower case.
+	TMap<FString, FAssetLocation> AssetsByOldPath;
+	TMap<FString, FAssetLocation> AssetsByNewPath;
+	for (const FRenameReport& Report : Reports)
+	{
+		OutMerged.Entries.Append(Report.Entries);
+
+		// Shards run side by side, so the merged timings are total agent time rather than wall time.
+		for (int32 PhaseIndex = 0; PhaseIndex < UE_ARRAY_COUNT(PhaseNames); ++PhaseIndex)
+		{
+			*GetPhaseFields(OutMerged.Phases, PhaseIndex) += GetPhase(Report.Phases, PhaseIndex);
+		}
+		OutMerged.PackagesSaved += Report.PackagesSaved;
+		OutMerged.BytesSaved += Report.BytesSaved;
+
+		for (const FEntry& Entry : Report.Entries)
+		{
+			if (const FAssetLocation* Existing = AssetsByOldPath.Find(Entry.OldObjectPath.ToLower()))
+			{
+				OutConflicts.Add(FString::Printf(TEXT("%s is processed by shard %d and shard %d."), *Entry.OldObjectPath, Existing->Shard, Report.Shard));
+				continue;
+			}
+			AssetsByOldPath.Add(Entry.OldObjectPath.ToLower(), { Report.Shard, &Entry });
+
+			if (Entry.Result != ERenameResult::Renamed)
+			{
+				continue;
+			}
+
+			if (const FAssetLocation* Existing = AssetsByNewPath.Find(Entry.NewObjectPath.ToLower()))
+			{
+				OutConflicts.Add(FString::Printf(TEXT("%s (shard %d) and %s (shard %d) are both renamed to %s."),
+					*Existing->Entry->OldObjectPath, Existing->Shard, *Entry.OldObjectPath, Report.Shard, *Entry.NewObjectPath));
+				continue;
+			}
+			AssetsByNewPath.Add(Entry.NewObjectPath.ToLower(), { Report.Shard, &Entry });
+		}
+	}
+
+	// A target must not be the path of an asset that another shard leaves in place.
+	for (const TPair<FString, FAssetLocation>& Pair : AssetsByNewPath)
+	{
+		const FAssetLocation* Existing = AssetsByOldPath.Find(Pair.Key);
+		if (Existing && Existing->Entry->Result != ERenameResult::Renamed)
+		{
+			OutConflicts.Add(FString::Printf(TEXT("%s (shard %d) is renamed to %s, which is kept by shard %d."),
+				*Pair.Value.Entry->OldObjectPath, Pair.Value.Shard, *Pair.Value.Entry->NewObjectPath, Existing->Shard));
+		}
+	}
+
+	return OutConflicts.IsEmpty();
+}
@@ -0,0 +1,104 @@
+// Copyright 2026 kurorekish. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FAssetRenameUtil.h"
+
+/**
+ * Machine-readable result of a commandlet run, written as JSON.
+ * Sharded runs each write one report; the merge step combines them and checks them for conflicts.
+ */
+struct FRenameReport
+{
+	/** One asset of the run. */
+	struct FEntry
+	{
+		/** Object path of the asset before the rename. */
+		FString OldObjectPath;
+
+		/** Object path after the rename. Only set when Result is Renamed. */
+		FString NewObjectPath;
+
+		/** The (planned, for a dry run) result for this asset. */
+		ERenameResult Result = ERenameResult::Failed;
+
+		/** Short explanation of the result. */
+		FString Reason;
+
+		/** Time spent loading the asset, in seconds. */
+		double LoadSeconds = 0.0;
+
+		/** The asset's share of its RenameAssets call, in seconds. */
+		double RenameSeconds = 0.0;
+
+		/** Number of packages that reference the asset. Only set for renames. */
+		int32 NumReferencers = 0;
+	};
+
+	/** Wall time of each phase of the run, in seconds. */
+	struct FPhaseTimings
+	{
+		double RegistryScan = 0.0;
+		double Query = 0.0;
+		double Planning = 0.0;
+		double Load = 0.0;
+		double Rename = 0.0;
+		double Save = 0.0;
+		double Total = 0.0;
+	};
+
+	/** The content path that was processed. */
+	FString Path;
+
+	/** Index of the shard that produced the report, and the total number of shards. */
+	int32 Shard = 0;
+	int32 NumShards = 1;
+
+	/** True if the report was produced by a dry run. */
+	bool bDryRun = false;
+
+	/** Wall time of each phase. Load and Rename are the sums of the per-asset durations. */
+	FPhaseTimings Phases;
+
+	/** Number of packages written by the save stage, and their size on disk in bytes. */
+	int32 PackagesSaved = 0;
+	int64 BytesSaved = 0;
+
+	/** Every asset of the run, in plan (execution) order. */
+	TArray<FEntry> Entries;
+
+	/**
+	 * Writes the report. A ".csv" file receives one row per asset; any other extension receives the full report as JSON.
+	 *
+	 * @param Filename The file to write.
+	 * @return True if the file was written.
+	 */
+	bool SaveToFile(const FString& Filename) const;
+
+	/**
+	 * Reads a report written by SaveToFile.
+	 *
+	 * @param Filename The file to read.
+	 * @return True if the file was read and parsed.
+	 */
+	bool LoadFromFile(const FString& Filename);
+
+	/**
+	 * Combines per-shard reports into one and checks that they are the complete set of shards of one run,
+	 * i.e. every report has the same NumShards and every shard from 0 to NumShards - 1 appears exactly once,
+	 * and that no two shards claim the same asset or rename different assets to the same path.
+	 *
+	 * @param Reports The reports to merge.
+	 * @param OutMerged Receives the entries of all reports, and the sums of their phase timings and save totals.
+	 * @param OutConflicts Receives one message per conflict.
+	 * @return True if no conflict was found.
+	 */
+	static bool Merge(TConstArrayView<FRenameReport> Reports, FRenameReport& OutMerged, TArray<FString>& OutConflicts);
+
+	/** @return The name used for a result in reports (e.g. "InvalidPattern"). */
+	static const TCHAR* ResultToString(ERenameResult Result);
+
+	/** @return True if the name was recognised and written to OutResult. */
+	static bool ResultFromString(FStringView String, ERenameResult& OutResult);
+};
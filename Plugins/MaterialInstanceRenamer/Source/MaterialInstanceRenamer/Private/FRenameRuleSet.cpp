@@ -0,0 +1,222 @@
+// Copyright 2026 kurorekish. All Rights Reserved.
+
+#include "FRenameRuleSet.h"
+#include "MaterialInstanceRenamerSettings.h"
+#include "Algo/Reverse.h"
+#include "Algo/Sort.h"
+#include "Misc/Crc.h"
+
+//----------------------------------------------------------------------//
+// FAffixTrie
+//----------------------------------------------------------------------//
+
+FRenameRuleSet::FAffixTrie::FAffixTrie(bool bInReversed)
+	: bReversed(bInReversed)
+{
+	Nodes.AddDefaulted(); // Root
+}
+
+int32 FRenameRuleSet::FAffixTrie::FindChild(int32 NodeIndex, TCHAR Char) const
+{
+	for (const TPair<TCHAR, int32>& Child : Nodes[NodeIndex].Children)
+	{
+		if (Child.Key == Char)
+		{
+			return Child.Value;
+		}
+	}
+	return INDEX_NONE;
+}
+
+void FRenameRuleSet::FAffixTrie::Add(FStringView Affix, EPrefixRank Rank)
+{
+	if (Affix.IsEmpty())
+	{
+		return;
+	}
+
+	int32 NodeIndex = 0;
+	for (int32 Offset = 0; Offset < Affix.Len(); ++Offset)
+	{
+		const TCHAR Char = FChar::ToLower(Affix[bReversed ? Affix.Len() - 1 - Offset : Offset]);
+		int32 ChildIndex = FindChild(NodeIndex, Char);
+		if (ChildIndex == INDEX_NONE)
+		{
+			ChildIndex = Nodes.AddDefaulted();
+			Nodes[NodeIndex].Children.Emplace(Char, ChildIndex);
+		}
+		NodeIndex = ChildIndex;
+	}
+
+	FNode& Node = Nodes[NodeIndex];
+	Node.Rank = Node.bTerminal ? FMath::Min(Node.Rank, Rank) : Rank;
+	Node.bTerminal = true;
+}
+
+void FRenameRuleSet::FAffixTrie::FindMatches(FStringView Name, FAffixMatchArray& OutMatches) const
+{
+	int32 NodeIndex = 0;
+	for (int32 Offset = 0; Offset < Name.Len(); ++Offset)
+	{
+		NodeIndex = FindChild(NodeIndex, FChar::ToLower(Name[bReversed ? Name.Len() - 1 - Offset : Offset]));
+		if (NodeIndex == INDEX_NONE)
+		{
+			return;
+		}
+
+		if (Nodes[NodeIndex].bTerminal)
+		{
+			OutMatches.Add({ Offset + 1, Nodes[NodeIndex].Rank });
+		}
+	}
+}
+
+//----------------------------------------------------------------------//
+// FRenameRuleSet
+//----------------------------------------------------------------------//
+
+FRenameRuleSet::FRenameRuleSet(const FString& InRenamePrefix, const FString& InSourcePrefix)
+	: FRenameRuleSet(InRenamePrefix, TArray<FString>{ InSourcePrefix }, TArray<FString>{ TEXT("_Inst") }, TArray<FString>{ TEXT("MI_") })
+{
+}
+
+FRenameRuleSet::FRenameRuleSet(const FString& InRenamePrefix, TConstArrayView<FString> SourcePrefixes, TConstArrayView<FString> InstanceSuffixes, TConstArrayView<FString> LegacyPrefixes)
+	: RenamePrefix(InRenamePrefix)
+	, PrefixTrie(false)
+	, SuffixTrie(true)
+	, bCleanUpRenamePrefixed(InRenamePrefix.Equals(TEXT("MI_"), ESearchCase::IgnoreCase))
+{
+	for (const FString& SourcePrefix : SourcePrefixes)
+	{
+		if (SourcePrefix.IsEmpty())
+		{
+			bAllowBareNames = true;
+			continue;
+		}
+
+		// Names that already carry the rename prefix in front of a source prefix are cleaned up first.
+		if (!RenamePrefix.IsEmpty())
+		{
+			PrefixTrie.Add(RenamePrefix + SourcePrefix, EPrefixRank::RenameAndSource);
+		}
+
+		// Legacy prefixes allow cleanup of old assets, but only if the rename prefix is not the same.
+		for (const FString& LegacyPrefix : LegacyPrefixes)
+		{
+			if (!LegacyPrefix.IsEmpty() && !LegacyPrefix.Equals(RenamePrefix, ESearchCase::IgnoreCase))
+			{
+				PrefixTrie.Add(LegacyPrefix + SourcePrefix, EPrefixRank::LegacyAndSource);
+			}
+		}
+
+		PrefixTrie.Add(SourcePrefix, EPrefixRank::Source);
+	}
+
+	for (const FString& InstanceSuffix : InstanceSuffixes)
+	{
+		SuffixTrie.Add(InstanceSuffix, EPrefixRank::None);
+	}
+
+	// Each rule list is hashed with a separator, so moving a string between lists changes the fingerprint.
+	Fingerprint = FCrc::StrCrc32(*RenamePrefix);
+	for (const TConstArrayView<FString> Rules : { SourcePrefixes, InstanceSuffixes, LegacyPrefixes })
+	{
+		for (const FString& Rule : Rules)
+		{
+			Fingerprint = FCrc::StrCrc32(*Rule, Fingerprint);
+			Fingerprint = FCrc::StrCrc32(TEXT("|"), Fingerprint);
+		}
+		Fingerprint = FCrc::StrCrc32(TEXT("#"), Fingerprint);
+	}
+}
+
+FRenameRuleSet FRenameRuleSet::FromSettings(const UMaterialInstanceRenamerSettings& Settings)
+{
+	check(IsInGameThread());
+
+	TArray<FString> SourcePrefixes;
+	SourcePrefixes.Add(Settings.SourcePrefix);
+	SourcePrefixes.Append(Settings.AdditionalSourcePrefixes);
+
+	return FRenameRuleSet(Settings.RenamePrefix, SourcePrefixes, Settings.InstanceSuffixes, Settings.LegacyPrefixes);
+}
+
+bool FRenameRuleSet::MatchAffixes(FStringView AssetName, int32& OutPrefixLen, int32& OutSuffixLen, EPrefixRank& OutRank) const
+{
+	// One pass from each end of the name collects every configured prefix and suffix that applies.
+	FAffixMatchArray Prefixes;
+	FAffixMatchArray Suffixes;
+	PrefixTrie.FindMatches(AssetName, Prefixes);
+	SuffixTrie.FindMatches(AssetName, Suffixes);
+
+	// Not having a prefix is a candidate too: on par with a source prefix if bare names are allowed,
+	// otherwise last and only together with a suffix.
+	Prefixes.Add({ 0, bAllowBareNames ? EPrefixRank::Source : EPrefixRank::None });
+
+	// Best rank first, longest first within a rank. Suffixes: longest first, then no suffix.
+	Algo::Sort(Prefixes, [](const FAffixMatch& A, const FAffixMatch& B)
+	{
+		return A.Rank != B.Rank ? A.Rank < B.Rank : A.Length > B.Length;
+	});
+	Algo::Reverse(Suffixes);
+	Suffixes.Add({ 0, EPrefixRank::None });
+
+	for (const FAffixMatch& Prefix : Prefixes)
+	{
+		for (const FAffixMatch& Suffix : Suffixes)
+		{
+			const bool bHasAffix = Prefix.Length > 0 || Suffix.Length > 0 || Prefix.Rank != EPrefixRank::None;
+			if (bHasAffix && Prefix.Length + Suffix.Length < AssetName.Len())
+			{
+				OutPrefixLen = Prefix.Length;
+				OutSuffixLen = Suffix.Length;
+				OutRank = Prefix.Rank;
+				return true;
+			}
+		}
+	}
+
+	return false; // No rule matched
+}
+
+ERenameResult FRenameRuleSet::Classify(FStringView AssetName, FString& OutNewAssetName) const
+{
+	int32 PrefixLen = 0;
+	int32 SuffixLen = 0;
+	EPrefixRank Rank = EPrefixRank::None;
+	const bool bMatched = MatchAffixes(AssetName, PrefixLen, SuffixLen, Rank);
+
+	// 1. Check if the asset should be skipped
+	// MI_ followed by a source prefix (e.g. MI_M_) is a special case for cleaning up material-prefixed instances.
+	// Other rename prefixes keep skipping such names, as they always have.
+	if (AssetName.StartsWith(RenamePrefix) && !(bCleanUpRenamePrefixed && bMatched && Rank == EPrefixRank::RenameAndSource))
+	{
+		return ERenameResult::Skipped;
+	}
+
+	if (!bMatched)
+	{
+		return ERenameResult::InvalidPattern;
+	}
+
+	// 2. Construct the new name from the base name
+	const FStringView BaseName = AssetName.Mid(PrefixLen, AssetName.Len() - PrefixLen - SuffixLen);
+	OutNewAssetName.Reset(RenamePrefix.Len() + BaseName.Len());
+	OutNewAssetName.Append(RenamePrefix);
+	OutNewAssetName.Append(BaseName);
+	return ERenameResult::Renamed;
+}
+
+bool FRenameRuleSet::ExtractBaseName(FStringView AssetName, FStringView& OutBaseName) const
+{
+	int32 PrefixLen = 0;
+	int32 SuffixLen = 0;
+	EPrefixRank Rank = EPrefixRank::None;
+	if (!MatchAffixes(AssetName, PrefixLen, SuffixLen, Rank))
+	{
+		return false;
+	}
+
+	OutBaseName = AssetName.Mid(PrefixLen, AssetName.Len() - PrefixLen - SuffixLen);
+	return true;
+}
@@ -0,0 +1,127 @@
+// Copyright 2026 kurorekish. All Rights Reserved.
+
+#include "FRenameRuleTable.h"
+#include "MaterialInstanceRenamerSettings.h"
+#include "AssetRegistry/AssetData.h"
+#include "Materials/MaterialInstanceConstant.h"
+#include "UObject/UObjectHash.h"
+#include "Algo/SortBy.h"
+#include "Misc/Crc.h"
+
+void FRenameRuleTable::Add(const FTopLevelAssetPath& ClassPath, FRenameRuleSet Rules, bool bIncludeSubclasses)
+{
+	if (!ClassPath.IsValid())
+	{
+		return;
+	}
+
+	const int32 RuleSetIndex = RuleSets.Add(MoveTemp(Rules));
+
+	// Configured classes whose rules overlap with this one, reported once each.
+	TSet<FTopLevelAssetPath> OverlappingClasses;
+
+	// The nearest configured class wins, so the result does not depend on the order the rules were added in.
+	// Equal depths only occur for a class added twice, where the later rules replace the earlier ones.
+	auto Assign = [this, &ClassPath, RuleSetIndex, &OverlappingClasses](const FTopLevelAssetPath& MappedClass, int32 Depth)
+	{
+		FClassEntry& Entry = RuleSetIndexByClass.FindOrAdd(MappedClass);
+		if (Entry.RuleSetIndex != INDEX_NONE)
+		{
+			OverlappingClasses.Add(Entry.ConfiguredClass);
+		}
+		if (Depth <= Entry.Depth)
+		{
+			Entry = FClassEntry{ RuleSetIndex, ClassPath, Depth };
+		}
+	};
+
+	Assign(ClassPath, 0);
+
+	// Only classes that are already in memory can be expanded; Blueprint classes that are not loaded are not found.
+	const UClass* Class = bIncludeSubclasses ? FindObject<UClass>(ClassPath) : nullptr;
+	if (Class)
+	{
+		TArray<UClass*> DerivedClasses;
+		GetDerivedClasses(Class, DerivedClasses, true);
+		for (const UClass* DerivedClass : DerivedClasses)
+		{
+			int32 Depth = 0;
+			for (const UClass* Super = DerivedClass; Super && Super != Class; Super = Super->GetSuperClass())
+			{
+				++Depth;
+			}
+			Assign(DerivedClass->GetClassPathName(), Depth);
+		}
+	}
+
+	for (const FTopLevelAssetPath& OverlappingClass : OverlappingClasses)
+	{
+		if (OverlappingClass == ClassPath)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Naming rules for '%s' are configured more than once. The rules added last are used."), *ClassPath.ToString());
+		}
+		else
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Naming rules for '%s' and '%s' overlap. Each class uses the rules of its nearest configured class."), *ClassPath.ToString(), *OverlappingClass.ToString());
+		}
+	}
+}
+
+FRenameRuleTable FRenameRuleTable::FromSettings(const UMaterialInstanceRenamerSettings& Settings)
+{
+	check(IsInGameThread());
+
+	FRenameRuleTable Table;
+	for (const FAssetClassNamingRule& Rule : Settings.AssetClassRules)
+	{
+		if (Rule.AssetClass.IsNull())
+		{
+			continue;
+		}
+
+		Table.Add(Rule.AssetClass.ToSoftObjectPath().GetAssetPath(), FRenameRuleSet(Rule.RenamePrefix, Rule.SourcePrefixes, Rule.Suffixes, Rule.LegacyPrefixes), Rule.bIncludeSubclasses);
+	}
+
+	// Added last, so the Material Instance rules win over an additional rule for the same class.
+	// Overlaps with other classes are resolved by the class hierarchy, not by this order.
+	Table.Add(UMaterialInstanceConstant::StaticClass()->GetClassPathName(), FRenameRuleSet::FromSettings(Settings), true);
+	return Table;
+}
+
+const FRenameRuleSet* FRenameRuleTable::Find(const FTopLevelAssetPath& ClassPath) const
+{
+	const FClassEntry* Entry = RuleSetIndexByClass.Find(ClassPath);
+	return Entry ? &RuleSets[Entry->RuleSetIndex] : nullptr;
+}
+
+const FRenameRuleSet* FRenameRuleTable::Find(const FAssetData& AssetData) const
+{
+	return Find(AssetData.AssetClassPath);
+}
+
+TArray<FTopLevelAssetPath> FRenameRuleTable::GetClassPaths() const
+{
+	TArray<FTopLevelAssetPath> ClassPaths;
+	RuleSetIndexByClass.GetKeys(ClassPaths);
+	return ClassPaths;
+}
+
+uint32 FRenameRuleTable::GetFingerprint() const
+{
+	// Hashed in class path order, so the order the rules were configured in does not matter.
+	TArray<TPair<FString, uint32>> ClassRules;
+	ClassRules.Reserve(RuleSetIndexByClass.Num());
+	for (const TPair<FTopLevelAssetPath, FClassEntry>& Pair : RuleSetIndexByClass)
+	{
+		ClassRules.Emplace(Pair.Key.ToString(), RuleSets[Pair.Value.RuleSetIndex].GetFingerprint());
+	}
+	Algo::SortBy(ClassRules, &TPair<FString, uint32>::Key);
+
+	uint32 Fingerprint = 0;
+	for (const TPair<FString, uint32>& ClassRule : ClassRules)
+	{
+		Fingerprint = FCrc::StrCrc32(*ClassRule.Key, Fingerprint);
+		Fingerprint = FCrc::MemCrc32(&ClassRule.Value, sizeof(ClassRule.Value), Fingerprint);
+	}
+	return Fingerprint;
+}
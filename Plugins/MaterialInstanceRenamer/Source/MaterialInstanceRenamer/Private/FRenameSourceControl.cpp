@@ -0,0 +1,171 @@
+// Copyright 2026 kurorekish. All Rights Reserved.
+
+#include "FRenameSourceControl.h"
+#include "FAssetRenameUtil.h"
+#include "MaterialInstanceRenamerTrace.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "ISourceControlModule.h"
+#include "ISourceControlProvider.h"
+#include "SourceControlOperations.h"
+#include "SourceControlHelpers.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+#include "HAL/PlatformTime.h"
+
+namespace RenameSourceControl_Private
+{
+	// Queries the state of the files in one round trip and returns the files that pass the filter
+	template <typename FilterType>
+	static TArray<FString> GetFilesInState(ISourceControlProvider& Provider, const TArray<FString>& Filenames, FilterType&& Filter)
+	{
+		TArray<FSourceControlStateRef> States;
+		Provider.GetState(Filenames, States, EStateCacheUsage::ForceUpdate);
+
+		TArray<FString> Result;
+		for (const FSourceControlStateRef& State : States)
+		{
+			if (Filter(State.Get()))
+			{
+				Result.Add(State->GetFilename());
+			}
+		}
+		return Result;
+	}
+}
+
+FRenameSourceControl::FBatchPackages FRenameSourceControl::GatherBatchPackages(TConstArrayView<FRenamePlanEntry> Entries, TFunctionRef<void(FName PackageName, TArray<FName>& OutReferencers)> GetReferencers)
+{
+	FBatchPackages Packages;
+
+	TSet<FName> RenamedPackages;
+	for (const FRenamePlanEntry& Entry : Entries)
+	{
+		if (Entry.Result == ERenameResult::Renamed)
+		{
+			bool bAlreadyInBatch = false;
+			RenamedPackages.Add(Entry.OldObjectPath.GetLongPackageFName(), &bAlreadyInBatch);
+			if (!bAlreadyInBatch)
+			{
+				Packages.PackagesToCheckOut.Add(Entry.OldObjectPath.GetLongPackageName());
+			}
+			Packages.PackagesToAdd.Add(Entry.NewObjectPath.GetLongPackageName());
+		}
+	}
+
+	// A referencer shared by several renames, or renamed itself, is listed once.
+	TSet<FName> ReferencerPackages;
+	TArray<FName> Referencers;
+	for (const FName PackageName : RenamedPackages)
+	{
+		Referencers.Reset();
+		GetReferencers(PackageName, Referencers);
+		for (const FName Referencer : Referencers)
+		{
+			bool bAlreadyListed = false;
+			if (!RenamedPackages.Contains(Referencer))
+			{
+				ReferencerPackages.Add(Referencer, &bAlreadyListed);
+				if (!bAlreadyListed)
+				{
+					Packages.PackagesToCheckOut.Add(Referencer.ToString());
+				}
+			}
+		}
+	}
+
+	return Packages;
+}
+
+FRenameSourceControl::FBatchPackages FRenameSourceControl::GatherBatchPackages(TConstArrayView<FRenamePlanEntry> Entries)
+{
+	IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+	return GatherBatchPackages(Entries, [&AssetRegistry](FName PackageName, TArray<FName>& OutReferencers)
+	{
+		AssetRegistry.GetReferencers(PackageName, OutReferencers);
+	});
+}
+
+bool FRenameSourceControl::IsActive()
+{
+	ISourceControlModule& SourceControlModule = ISourceControlModule::Get();
+	return SourceControlModule.IsEnabled() && SourceControlModule.GetProvider().IsAvailable();
+}
+
+bool FRenameSourceControl::CheckOutPackages(TConstArrayView<FString> PackageNames)
+{
+	check(IsInGameThread());
+	if (PackageNames.IsEmpty() || !IsActive())
+	{
+		return true;
+	}
+
+	MIRENAMER_TRACE_SCOPE(SourceControlCheckOut);
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Packages are resolved to files with their real extension; packages that are not on disk have nothing to check out.
+	TArray<FString> Filenames = SourceControlHelpers::PackageFilenames(TArray<FString>(PackageNames));
+	Filenames.RemoveAll([](const FString& Filename) { return !IFileManager::Get().FileExists(*Filename); });
+	if (Filenames.IsEmpty())
+	{
+		return true;
+	}
+
+	ISourceControlProvider& Provider = ISourceControlModule::Get().GetProvider();
+	const TArray<FString> FilesToCheckOut = RenameSourceControl_Private::GetFilesInState(Provider, Filenames, [](const ISourceControlState& State)
+	{
+		return State.IsSourceControlled() && State.CanCheckout();
+	});
+
+	bool bSucceeded = true;
+	if (!FilesToCheckOut.IsEmpty())
+	{
+		bSucceeded = Provider.Execute(ISourceControlOperation::Create<FCheckOut>(), FilesToCheckOut) == ECommandResult::Succeeded;
+		if (!bSucceeded)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Failed to check out %d files from %s."), FilesToCheckOut.Num(), *Provider.GetName().ToString());
+		}
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("Source control: queried %d files and checked out %d in %.3f seconds."),
+		Filenames.Num(), bSucceeded ? FilesToCheckOut.Num() : 0, FPlatformTime::Seconds() - StartTime);
+	return bSucceeded;
+}
+
+bool FRenameSourceControl::MarkFilesForAdd(TConstArrayView<FString> Filenames)
+{
+	check(IsInGameThread());
+	if (Filenames.IsEmpty() || !IsActive())
+	{
+		return true;
+	}
+
+	MIRENAMER_TRACE_SCOPE(SourceControlMarkForAdd);
+	const double StartTime = FPlatformTime::Seconds();
+
+	TArray<FString> AbsoluteFilenames;
+	AbsoluteFilenames.Reserve(Filenames.Num());
+	for (const FString& Filename : Filenames)
+	{
+		AbsoluteFilenames.Add(FPaths::ConvertRelativePathToFull(Filename));
+	}
+
+	ISourceControlProvider& Provider = ISourceControlModule::Get().GetProvider();
+	const TArray<FString> FilesToAdd = RenameSourceControl_Private::GetFilesInState(Provider, AbsoluteFilenames, [](const ISourceControlState& State)
+	{
+		return !State.IsSourceControlled() && State.CanAdd();
+	});
+
+	bool bSucceeded = true;
+	if (!FilesToAdd.IsEmpty())
+	{
+		bSucceeded = Provider.Execute(ISourceControlOperation::Create<FMarkForAdd>(), FilesToAdd) == ECommandResult::Succeeded;
+		if (!bSucceeded)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Failed to mark %d files for add in %s."), FilesToAdd.Num(), *Provider.GetName().ToString());
+		}
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("Source control: queried %d files and marked %d for add in %.3f seconds."),
+		AbsoluteFilenames.Num(), bSucceeded ? FilesToAdd.Num() : 0, FPlatformTime::Seconds() - StartTime);
+	return bSucceeded;
+}
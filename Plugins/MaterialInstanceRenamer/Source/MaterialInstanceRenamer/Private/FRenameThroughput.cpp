@@ -0,0 +1,99 @@
+// Copyright 2026 kurorekish. All Rights Reserved.
+
+#include "FRenameThroughput.h"
+#include "FAssetRenameUtil.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+
+namespace RenameThroughput_Private
+{
+	// First field of the header line
+	static const TCHAR* const Magic = TEXT("MIRenamerThroughput");
+
+	// Bumped whenever the file layout changes
+	static constexpr int32 Version = 1;
+}
+
+FString FRenameThroughput::GetDefaultFilename()
+{
+	return FPaths::ProjectSavedDir() / TEXT("MaterialInstanceRenamer") / TEXT("Throughput.txt");
+}
+
+bool FRenameThroughput::Load(const FString& Filename)
+{
+	using namespace RenameThroughput_Private;
+
+	*this = FRenameThroughput();
+
+	TArray<FString> Lines;
+	if (!FPaths::FileExists(Filename) || !FFileHelper::LoadFileToStringArray(Lines, *Filename) || Lines.Num() < 2)
+	{
+		return false;
+	}
+
+	// Header: Magic, Version
+	TArray<FString> Fields;
+	Lines[0].ParseIntoArray(Fields, TEXT("\t"), false);
+	if (Fields.Num() != 2 || Fields[0] != Magic || FCString::Atoi(*Fields[1]) != Version)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Throughput file %s has an unknown format and will be rebuilt."), *Filename);
+		return false;
+	}
+
+	// Totals: NumRuns, NumRenamed, RenameSeconds, BytesSaved, SaveSeconds
+	Lines[1].ParseIntoArray(Fields, TEXT("\t"), false);
+	if (Fields.Num() != 5)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Throughput file %s has an unknown format and will be rebuilt."), *Filename);
+		return false;
+	}
+
+	NumRuns = FCString::Atoi(*Fields[0]);
+	NumRenamed = FCString::Atoi64(*Fields[1]);
+	RenameSeconds = FCString::Atod(*Fields[2]);
+	BytesSaved = FCString::Atoi64(*Fields[3]);
+	SaveSeconds = FCString::Atod(*Fields[4]);
+	return true;
+}
+
+bool FRenameThroughput::Save(const FString& Filename) const
+{
+	using namespace RenameThroughput_Private;
+
+	const FString Contents = FString::Printf(TEXT("%s\t%d\n%d\t%lld\t%.6f\t%lld\t%.6f\n"), Magic, Version, NumRuns, NumRenamed, RenameSeconds, BytesSaved, SaveSeconds);
+
+	IFileManager::Get().MakeDirectory(*FPaths::GetPath(Filename), true);
+	if (!FFileHelper::SaveStringToFile(Contents, *Filename))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Failed to write throughput file %s."), *Filename);
+		return false;
+	}
+	return true;
+}
+
+void FRenameThroughput::AddRun(int32 InNumRenamed, double InRenameSeconds, int64 InBytesSaved, double InSaveSeconds)
+{
+	NumRuns++;
+	NumRenamed += InNumRenamed;
+	RenameSeconds += InRenameSeconds;
+	BytesSaved += InBytesSaved;
+	SaveSeconds += InSaveSeconds;
+}
+
+double FRenameThroughput::ProjectSeconds(const FRenameImpactEstimate& Estimate) const
+{
+	if (NumRuns == 0 || NumRenamed == 0)
+	{
+		return -1.0;
+	}
+
+	double Seconds = Estimate.NumRenames * (RenameSeconds / NumRenamed);
+
+	// Runs with -NoSave measured no save rate; their projection covers the renames only.
+	if (BytesSaved > 0)
+	{
+		Seconds += (Estimate.RenamedBytes + Estimate.ReferencerBytes) * (SaveSeconds / BytesSaved);
+	}
+	return Seconds;
+}
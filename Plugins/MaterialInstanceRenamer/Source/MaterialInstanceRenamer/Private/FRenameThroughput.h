@@ -0,0 +1,65 @@
+// Copyright 2026 kurorekish. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FRenameImpactEstimate;
+
+/**
+ * Throughput measured by previous commandlet runs, persisted so that estimates can project a runtime.
+ *
+ * The totals of all recorded runs are kept rather than the last rates, so each run weighs in
+ * proportion to the work it did.
+ */
+class FRenameThroughput
+{
+public:
+	/** @return The file the commandlet records its throughput in, below the project's Saved directory. */
+	static FString GetDefaultFilename();
+
+	/**
+	 * Reads recorded throughput. A missing file or an unknown version leaves nothing recorded.
+	 *
+	 * @param Filename The throughput file.
+	 * @return True if throughput was loaded.
+	 */
+	bool Load(const FString& Filename);
+
+	/**
+	 * Writes the recorded throughput.
+	 *
+	 * @param Filename The throughput file.
+	 * @return True if the file was written.
+	 */
+	bool Save(const FString& Filename) const;
+
+	/**
+	 * Records a run.
+	 *
+	 * @param InNumRenamed Material Instances renamed by the run.
+	 * @param InRenameSeconds Time spent loading and renaming them.
+	 * @param InBytesSaved Bytes written by the save stage. Zero if nothing was saved.
+	 * @param InSaveSeconds Time spent saving.
+	 */
+	void AddRun(int32 InNumRenamed, double InRenameSeconds, int64 InBytesSaved, double InSaveSeconds);
+
+	/** @return The number of recorded runs. */
+	int32 GetNumRuns() const { return NumRuns; }
+
+	/**
+	 * Projects the runtime of a plan: renames at the recorded rename rate, plus the renamed and
+	 * referencer packages at the recorded save rate.
+	 *
+	 * @param Estimate The plan's impact estimate.
+	 * @return The projected runtime in seconds, or a negative value if no run has been recorded.
+	 */
+	double ProjectSeconds(const FRenameImpactEstimate& Estimate) const;
+
+private:
+	int32 NumRuns = 0;
+	int64 NumRenamed = 0;
+	double RenameSeconds = 0.0;
+	int64 BytesSaved = 0;
+	double SaveSeconds = 0.0;
+};
@@ -0,0 +1,140 @@
+// Copyright 2026 kurorekish. All Rights Reserved.
+
+#include "FRenameWatcher.h"
+#include "DirectoryWatcherModule.h"
+#include "IDirectoryWatcher.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Misc/PathViews.h"
+#include "Modules/ModuleManager.h"
+
+namespace RenameWatcher_Private
+{
+	static IDirectoryWatcher* GetDirectoryWatcher()
+	{
+		FDirectoryWatcherModule& DirectoryWatcherModule = FModuleManager::LoadModuleChecked<FDirectoryWatcherModule>(TEXT("DirectoryWatcher"));
+		return DirectoryWatcherModule.Get();
+	}
+
+	static bool IsPackageFile(const FString& Filename)
+	{
+		const FStringView Extension = FPathViews::GetExtension(Filename, true);
+		return Extension == FPackageName::GetAssetPackageExtension() || Extension == FPackageName::GetMapPackageExtension();
+	}
+}
+
+FRenameWatcher::~FRenameWatcher()
+{
+	Stop();
+}
+
+bool FRenameWatcher::Start(const FString& PackagePath)
+{
+	using namespace RenameWatcher_Private;
+
+	Stop();
+
+	FString PackageDirectory;
+	if (!FPackageName::TryConvertLongPackageNameToFilename(PackagePath / TEXT(""), PackageDirectory))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Path %s is not a mounted content path and cannot be watched."), *PackagePath);
+		return false;
+	}
+
+	IDirectoryWatcher* DirectoryWatcher = GetDirectoryWatcher();
+	Directory = FPaths::ConvertRelativePathToFull(PackageDirectory);
+	if (!DirectoryWatcher || !DirectoryWatcher->RegisterDirectoryChangedCallback_Handle(Directory,
+		IDirectoryWatcher::FDirectoryChanged::CreateRaw(this, &FRenameWatcher::OnDirectoryChanged), WatcherHandle))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to watch %s."), *Directory);
+		Directory.Reset();
+		return false;
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("Watching %s for new and modified packages."), *Directory);
+	return true;
+}
+
+void FRenameWatcher::Stop()
+{
+	if (WatcherHandle.IsValid())
+	{
+		if (IDirectoryWatcher* DirectoryWatcher = RenameWatcher_Private::GetDirectoryWatcher())
+		{
+			DirectoryWatcher->UnregisterDirectoryChangedCallback_Handle(Directory, WatcherHandle);
+		}
+		WatcherHandle.Reset();
+	}
+	PendingFilenames.Reset();
+	bRescanRequired = false;
+}
+
+bool FRenameWatcher::Poll(float DeltaSeconds, double SettleSeconds, TArray<FString>& OutFilenames)
+{
+	OutFilenames.Reset();
+	if (!WatcherHandle.IsValid())
+	{
+		return false;
+	}
+
+	// Outside the editor nothing else ticks the watcher, so notifications are only delivered from here.
+	if (IDirectoryWatcher* DirectoryWatcher = RenameWatcher_Private::GetDirectoryWatcher())
+	{
+		DirectoryWatcher->Tick(DeltaSeconds);
+	}
+
+	if ((PendingFilenames.IsEmpty() && !bRescanRequired) || FPlatformTime::Seconds() - LastChangeTime < SettleSeconds)
+	{
+		return false;
+	}
+
+	if (bRescanRequired)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Change notifications for %s were lost. Checking every package below it."), *Directory);
+		TArray<FString> Filenames;
+		IFileManager::Get().FindFilesRecursive(Filenames, *Directory, TEXT("*"), true, false);
+		for (const FString& Filename : Filenames)
+		{
+			if (RenameWatcher_Private::IsPackageFile(Filename))
+			{
+				PendingFilenames.Add(Filename);
+			}
+		}
+		bRescanRequired = false;
+	}
+
+	// A file that was added and removed again before the directory settled has nothing to rename.
+	OutFilenames.Reserve(PendingFilenames.Num());
+	for (const FString& Filename : PendingFilenames)
+	{
+		if (IFileManager::Get().FileExists(*Filename))
+		{
+			OutFilenames.Add(Filename);
+		}
+	}
+	PendingFilenames.Reset();
+
+	return !OutFilenames.IsEmpty();
+}
+
+void FRenameWatcher::OnDirectoryChanged(const TArray<FFileChangeData>& Changes)
+{
+	for (const FFileChangeData& Change : Changes)
+	{
+		if (Change.Action == FFileChangeData::FCA_RescanRequired)
+		{
+			bRescanRequired = true;
+		}
+		else if (Change.Action != FFileChangeData::FCA_Removed && RenameWatcher_Private::IsPackageFile(Change.Filename))
+		{
+			PendingFilenames.Add(FPaths::ConvertRelativePathToFull(Change.Filename));
+		}
+	}
+
+	if (!Changes.IsEmpty())
+	{
+		LastChangeTime = FPlatformTime::Seconds();
+	}
+}
@@ -0,0 +1,53 @@
+// Copyright 2026 kurorekish. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FFileChangeData;
+
+/**
+ * Watches the directory of a content path for package files that are added or modified, for the commandlet's -Watch mode.
+ *
+ * Change notifications come from IDirectoryWatcher, which a commandlet has to tick itself; Poll does that.
+ * Changed files are collected until no further change arrived for a settle time, so a package that is written
+ * in several steps, or a burst of imported packages, is handed out once as one batch.
+ */
+class FRenameWatcher
+{
+public:
+	~FRenameWatcher();
+
+	/**
+	 * Starts watching the directory a content path is mounted at, including its subdirectories.
+	 *
+	 * @param PackagePath The content path to watch (e.g. "/Game").
+	 * @return False if the path is not mounted or the directory cannot be watched.
+	 */
+	bool Start(const FString& PackagePath);
+
+	/** Stops watching. Called by the destructor. */
+	void Stop();
+
+	/**
+	 * Ticks the directory watcher and hands out the package files changed since the previous batch,
+	 * once no change arrived for SettleSeconds. Files that no longer exist are left out.
+	 *
+	 * @param DeltaSeconds Time since the previous poll.
+	 * @param SettleSeconds How long the directory has to stay unchanged before a batch is handed out.
+	 * @param OutFilenames Receives the changed package files.
+	 * @return True if a batch was handed out.
+	 */
+	bool Poll(float DeltaSeconds, double SettleSeconds, TArray<FString>& OutFilenames);
+
+private:
+	void OnDirectoryChanged(const TArray<FFileChangeData>& Changes);
+
+	FString Directory;
+	FDelegateHandle WatcherHandle;
+	TSet<FString> PendingFilenames;
+	double LastChangeTime = 0.0;
+
+	/** Set when the watcher lost notifications; the next batch lists every package file below the directory. */
+	bool bRescanRequired = false;
+};
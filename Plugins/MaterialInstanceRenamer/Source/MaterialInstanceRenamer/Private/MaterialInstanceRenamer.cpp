@@ -2,14 +2,18 @@
 
 #include "MaterialInstanceRenamer.h"
 #include "FAssetRenameUtil.h"
+#include "FAssetNameIndex.h"
+#include "FRenameRuleTable.h"
+#include "FRenameThroughput.h"
+#include "MaterialInstanceRenamerTrace.h"
 #include "MaterialInstanceRenamerSettings.h"
 #include "ISettingsModule.h"
+#include "ISettingsSection.h"
 #include "Modules/ModuleManager.h"
 #include "ToolMenus.h"
 #include "ContentBrowserModule.h"
 #include "ContentBrowserMenuContexts.h"
 #include "Materials/MaterialInterface.h"
-#include "Materials/MaterialInstanceConstant.h"
 #include "Internationalization/Culture.h"
 #include "Internationalization/Internationalization.h"
 #include "Misc/MessageDialog.h"
@@ -20,6 +24,9 @@
 #include "Algo/AnyOf.h"
 #include "Framework/Notifications/NotificationManager.h"
 #include "Widgets/Notifications/SNotificationList.h"
+#include "Async/Async.h"
+#include "Containers/Ticker.h"
+#include "HAL/PlatformTime.h"
 
 #define LOCTEXT_NAMESPACE "FMaterialInstanceRenamerModule"
 
@@ -85,8 +92,8 @@ private:
         EnMap.Emplace(TEXT("RenameSelected"), LOCTEXT("RenameSelected_EN", "Rename with Prefix ({0})"));
         EnMap.Emplace(TEXT("RenameSelectedTooltip"), LOCTEXT("RenameSelectedTooltip_EN", "Rename the selected Material Instance(s) to the recommended prefix ({0})."));
         EnMap.Emplace(TEXT("ConfirmBatchRename"), LOCTEXT("ConfirmBatchRename_EN", "Do you want to rename all Material Instances in the project? ({0})"));
-        EnMap.Emplace(TEXT("NoAssetsFound"), LOCTEXT("NoAssetsFound_EN", "No Material Instances found to rename."));
-        EnMap.Emplace(TEXT("RenamingProgress"), LOCTEXT("RenamingProgress_EN", "Renaming Material Instances..."));
+        EnMap.Emplace(TEXT("NoAssetsFound"), LOCTEXT("NoAssetsFound_EN", "No assets found to rename."));
+        EnMap.Emplace(TEXT("RenamingProgress"), LOCTEXT("RenamingProgress_EN", "Renaming assets..."));
         EnMap.Emplace(TEXT("NotAMaterialInstance"), LOCTEXT("NotAMaterialInstance_EN", "The selected asset is not a Material Instance."));
         EnMap.Emplace(TEXT("RenameComplete"), LOCTEXT("RenameComplete_EN", "Rename Complete"));
         EnMap.Emplace(TEXT("RenameSummary"), LOCTEXT("RenameSummary_EN", "Renamed: {0}\nSkipped: {1}\nFailed: {2}\nInvalid Pattern: {3}"));
@@ -94,10 +101,23 @@ private:
         EnMap.Emplace(TEXT("AutoRenameOnCreateTooltip"), LOCTEXT("AutoRenameOnCreateTooltip_EN", "Toggle auto-renaming of material instances on creation"));
         EnMap.Emplace(TEXT("ShowNotificationOnAutoRename"), LOCTEXT("ShowNotificationOnAutoRename_EN", "Show Notification on Auto-Rename"));
         EnMap.Emplace(TEXT("AutoRenameNotification"), LOCTEXT("AutoRenameNotification_EN", "Renamed {0} to {1}"));
+        EnMap.Emplace(TEXT("AutoRenameBatchNotification"), LOCTEXT("AutoRenameBatchNotification_EN", "Renamed {0} assets"));
 		EnMap.Emplace(TEXT("MenuSection"), LOCTEXT("MenuSection_EN", "MaterialInstanceRenamer"));
 		EnMap.Emplace(TEXT("MenuSubMenu"), LOCTEXT("MenuSubMenu_EN", "MaterialInstanceRenamer"));
 		EnMap.Emplace(TEXT("MenuSubMenuTooltip"), LOCTEXT("MenuSubMenuTooltip_EN", "Material Instance Renamer Tools"));
 		EnMap.Emplace(TEXT("MenuGeneralSection"), LOCTEXT("MenuGeneralSection_EN", "General"));
+		EnMap.Emplace(TEXT("WaitingForAssetRegistry"), LOCTEXT("WaitingForAssetRegistry_EN", "Waiting for asset discovery to finish..."));
+		EnMap.Emplace(TEXT("PlanningRenames"), LOCTEXT("PlanningRenames_EN", "Planning renames..."));
+		EnMap.Emplace(TEXT("RenamingCount"), LOCTEXT("RenamingCount_EN", "Renaming assets ({0} / {1})"));
+		EnMap.Emplace(TEXT("RenameCanceled"), LOCTEXT("RenameCanceled_EN", "Rename Canceled"));
+		EnMap.Emplace(TEXT("RenameAlreadyRunning"), LOCTEXT("RenameAlreadyRunning_EN", "Assets are already being renamed."));
+		EnMap.Emplace(TEXT("Cancel"), LOCTEXT("Cancel_EN", "Cancel"));
+		EnMap.Emplace(TEXT("EstimateRenameAll"), LOCTEXT("EstimateRenameAll_EN", "Estimate Rename All"));
+		EnMap.Emplace(TEXT("EstimateRenameAllTooltip"), LOCTEXT("EstimateRenameAllTooltip_EN", "Show what renaming all Material Instances would change, without loading any asset."));
+		EnMap.Emplace(TEXT("EstimateTitle"), LOCTEXT("EstimateTitle_EN", "Rename All Estimate"));
+		EnMap.Emplace(TEXT("EstimateSummary"), LOCTEXT("EstimateSummary_EN", "Assets to rename: {0} ({1})\nReferencing packages to dirty: {2} ({3})\n{4}"));
+		EnMap.Emplace(TEXT("EstimateProjected"), LOCTEXT("EstimateProjected_EN", "Projected commandlet runtime: {0} (from {1} previous runs)"));
+		EnMap.Emplace(TEXT("EstimateNoThroughput"), LOCTEXT("EstimateNoThroughput_EN", "Projected runtime: unknown until the commandlet has renamed assets once"));
 
         // Japanese
         TMap<FString, FText>& JaMap = Table.Emplace(TEXT("ja"));
@@ -106,8 +126,8 @@ private:
         JaMap.Emplace(TEXT("RenameSelected"), LOCTEXT("RenameSelected_JP", "プレフィックス({0})でリネーム"));
         JaMap.Emplace(TEXT("RenameSelectedTooltip"), LOCTEXT("RenameSelectedTooltip_JP", "選択したマテリアルインスタンスを推奨プレフィックス（{0}）にリネームします。"));
         JaMap.Emplace(TEXT("ConfirmBatchRename"), LOCTEXT("ConfirmBatchRename_JP", "プロジェクト内のすべてのマテリアルインスタンスをリネームしますか？（{0}）"));
-        JaMap.Emplace(TEXT("NoAssetsFound"), LOCTEXT("NoAssetsFound_JP", "リネーム対象のマテリアルインスタンスが見つかりませんでした。"));
-        JaMap.Emplace(TEXT("RenamingProgress"), LOCTEXT("RenamingProgress_JP", "マテリアルインスタンスをリネーム中..."));
+        JaMap.Emplace(TEXT("NoAssetsFound"), LOCTEXT("NoAssetsFound_JP", "リネーム対象のアセットが見つかりませんでした。"));
+        JaMap.Emplace(TEXT("RenamingProgress"), LOCTEXT("RenamingProgress_JP", "アセットをリネーム中..."));
         JaMap.Emplace(TEXT("NotAMaterialInstance"), LOCTEXT("NotAMaterialInstance_JP", "選択されたアセットはマテリアルインスタンスではありません。"));
         JaMap.Emplace(TEXT("RenameComplete"), LOCTEXT("RenameComplete_JP", "リネーム完了"));
         JaMap.Emplace(TEXT("RenameSummary"), LOCTEXT("RenameSummary_JP", "リネーム: {0}\nスキップ: {1}\n失敗: {2}\n不正なパターン: {3}"));
@@ -115,10 +135,23 @@ private:
         JaMap.Emplace(TEXT("AutoRenameOnCreateTooltip"), LOCTEXT("AutoRenameOnCreateTooltip_JP", "作成時のマテリアルインスタンスの自動リネームを切り替えます"));
         JaMap.Emplace(TEXT("ShowNotificationOnAutoRename"), LOCTEXT("ShowNotificationOnAutoRename_JP", "自動リネーム時に通知を表示"));
         JaMap.Emplace(TEXT("AutoRenameNotification"), LOCTEXT("AutoRenameNotification_JP", "{0} を {1} にリネームしました"));
+        JaMap.Emplace(TEXT("AutoRenameBatchNotification"), LOCTEXT("AutoRenameBatchNotification_JP", "{0} 個のアセットをリネームしました"));
         JaMap.Emplace(TEXT("MenuSection"), LOCTEXT("MenuSection_JP", "MaterialInstanceRenamer"));
         JaMap.Emplace(TEXT("MenuSubMenu"), LOCTEXT("MenuSubMenu_JP", "MaterialInstanceRenamer"));
 		JaMap.Emplace(TEXT("MenuSubMenuTooltip"), LOCTEXT("MenuSubMenuTooltip_JP", "Material Instance Renamer ツール"));
 		JaMap.Emplace(TEXT("MenuGeneralSection"), LOCTEXT("MenuGeneralSection_JP", "一般"));
+		JaMap.Emplace(TEXT("WaitingForAssetRegistry"), LOCTEXT("WaitingForAssetRegistry_JP", "アセットの検出が完了するのを待っています..."));
+		JaMap.Emplace(TEXT("PlanningRenames"), LOCTEXT("PlanningRenames_JP", "リネームを計画中..."));
+		JaMap.Emplace(TEXT("RenamingCount"), LOCTEXT("RenamingCount_JP", "アセットをリネーム中 ({0} / {1})"));
+		JaMap.Emplace(TEXT("RenameCanceled"), LOCTEXT("RenameCanceled_JP", "リネームをキャンセルしました"));
+		JaMap.Emplace(TEXT("RenameAlreadyRunning"), LOCTEXT("RenameAlreadyRunning_JP", "アセットは既にリネーム中です。"));
+		JaMap.Emplace(TEXT("Cancel"), LOCTEXT("Cancel_JP", "キャンセル"));
+		JaMap.Emplace(TEXT("EstimateRenameAll"), LOCTEXT("EstimateRenameAll_JP", "一括リネームの影響を見積もる"));
+		JaMap.Emplace(TEXT("EstimateRenameAllTooltip"), LOCTEXT("EstimateRenameAllTooltip_JP", "アセットをロードせずに、すべてのマテリアルインスタンスをリネームした場合の変更内容を表示します。"));
+		JaMap.Emplace(TEXT("EstimateTitle"), LOCTEXT("EstimateTitle_JP", "一括リネームの見積もり"));
+		JaMap.Emplace(TEXT("EstimateSummary"), LOCTEXT("EstimateSummary_JP", "リネームされるアセット: {0} ({1})\n変更される参照元パッケージ: {2} ({3})\n{4}"));
+		JaMap.Emplace(TEXT("EstimateProjected"), LOCTEXT("EstimateProjected_JP", "コマンドレットの予想実行時間: {0}（過去 {1} 回の実行から算出）"));
+		JaMap.Emplace(TEXT("EstimateNoThroughput"), LOCTEXT("EstimateNoThroughput_JP", "予想実行時間: コマンドレットで一度アセットをリネームするまで不明です"));
 
         return Table;
     }
@@ -128,6 +161,32 @@ private:
 
 const TMap<FString, TMap<FString, FText>> FLocalizationManager::LocalizationTable = FLocalizationManager::CreateLocalizationTable();
 
+/**
+ * Resolves the redirectors left behind by a bulk rename, if enabled in the settings.
+ *
+ * @param Outcomes The outcomes of the rename. Only renamed assets leave a redirector.
+ */
+static void FixupRedirectorsIfEnabled(TConstArrayView<FRenameOutcome> Outcomes)
+{
+    if (!GetDefault<UMaterialInstanceRenamerSettings>()->bFixupRedirectorsAfterRename)
+    {
+        return;
+    }
+
+    TArray<FSoftObjectPath> OldObjectPaths;
+    for (const FRenameOutcome& Outcome : Outcomes)
+    {
+        if (Outcome.Result == ERenameResult::Renamed)
+        {
+            OldObjectPaths.Add(Outcome.OldObjectPath);
+        }
+    }
+
+    if (!OldObjectPaths.IsEmpty())
+    {
+        FAssetRenameUtil::FixupRedirectors(OldObjectPaths, true);
+    }
+}
 
 //----------------------------------------------------------------------//
 // Context Menu Logic
@@ -150,7 +209,7 @@ namespace MenuExtension_MaterialInstance
         TArray<FAssetData> MaterialInstances;
         for (const FAssetData& AssetData : Context->SelectedAssets)
         {
-            if (AssetData.GetClass()->IsChildOf(UMaterialInstanceConstant::StaticClass()))
+            if (FAssetRenameUtil::IsMaterialInstance(AssetData))
             {
                 MaterialInstances.Add(AssetData);
             }
@@ -167,14 +226,23 @@ namespace MenuExtension_MaterialInstance
 
         int32 RenamedCount = 0, SkippedCount = 0, FailedCount = 0, InvalidPatternCount = 0;
 
-        for (const FAssetData& AssetData : MaterialInstances)
+        FRenameBatchOptions BatchOptions;
+        BatchOptions.bBulkCheckOut = true;
+        int32 LastProcessed = 0;
+        BatchOptions.OnBatchCompleted = [&SlowTask, &LastProcessed](int32 NumProcessed, int32 NumTotal)
         {
-            FString AssetName = AssetData.AssetName.ToString();
-            SlowTask.EnterProgressFrame(1, FText::Format(LOCTEXT("RenamingAsset", "Renaming {0}..."), FText::FromString(AssetName)));
+            SlowTask.EnterProgressFrame(NumProcessed - LastProcessed, FText::Format(LOCTEXT("RenamingBatch", "Renaming {0} / {1}..."), FText::AsNumber(NumProcessed), FText::AsNumber(NumTotal)));
+            LastProcessed = NumProcessed;
+            return true;
+        };
+
+        TArray<FRenameOutcome> Outcomes;
+        FAssetRenameUtil::RenameMaterialInstances(MaterialInstances, Outcomes, BatchOptions);
+        FixupRedirectorsIfEnabled(Outcomes);
 
-			FString NewName;
-            const ERenameResult Result = FAssetRenameUtil::RenameMaterialInstance(AssetData, NewName);
-            switch (Result)
+        for (const FRenameOutcome& Outcome : Outcomes)
+        {
+            switch (Outcome.Result)
             {
                 case ERenameResult::Renamed: RenamedCount++; break;
                 case ERenameResult::Skipped: SkippedCount++; break;
@@ -202,24 +270,321 @@ namespace MenuExtension_MaterialInstance
     }
 }
 
+//----------------------------------------------------------------------//
+// Non-blocking Rename All
+//----------------------------------------------------------------------//
+
+/**
+ * Renames all Material Instances under /Game without blocking the editor.
+ * Waits for the asset registry's background scan instead of scanning synchronously, plans on a worker
+ * thread, then renames in small slices from the core ticker within a per-frame time budget.
+ * Progress, cancellation and the result are shown in a non-modal notification.
+ */
+class FAsyncRenameAllOperation : public TSharedFromThis<FAsyncRenameAllOperation>
+{
+public:
+    /**
+     * @param InIsRenamingAsset The module's re-entrancy flag, raised while a slice is being renamed.
+     * @param InFrameBudgetMs Time per frame spent renaming, in milliseconds.
+     */
+    FAsyncRenameAllOperation(bool& InIsRenamingAsset, float InFrameBudgetMs)
+        : bIsRenamingAsset(InIsRenamingAsset)
+        , FrameBudgetSeconds(FMath::Max(InFrameBudgetMs, 1.0f) / 1000.0)
+    {
+    }
+
+    ~FAsyncRenameAllOperation()
+    {
+        if (TickerHandle.IsValid())
+        {
+            FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+        }
+
+        if (FilesLoadedHandle.IsValid())
+        {
+            if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+            {
+                AssetRegistry->OnFilesLoaded().Remove(FilesLoadedHandle);
+            }
+        }
+    }
+
+    /** Shows the notification and starts the operation. */
+    void Start()
+    {
+        FNotificationInfo Info(FLocalizationManager::GetText("WaitingForAssetRegistry"));
+        Info.bFireAndForget = false;
+        Info.bUseThrobber = true;
+        Info.ExpireDuration = 5.0f;
+        Info.ButtonDetails.Add(FNotificationButtonInfo(
+            FLocalizationManager::GetText("Cancel"),
+            FText(),
+            FSimpleDelegate::CreateSP(this, &FAsyncRenameAllOperation::Cancel),
+            SNotificationItem::CS_Pending
+        ));
+        Notification = FSlateNotificationManager::Get().AddNotification(Info);
+        if (Notification.IsValid())
+        {
+            Notification->SetCompletionState(SNotificationItem::CS_Pending);
+        }
+
+        IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+        if (AssetRegistry.IsLoadingAssets())
+        {
+            FilesLoadedHandle = AssetRegistry.OnFilesLoaded().AddSP(this, &FAsyncRenameAllOperation::OnFilesLoaded);
+        }
+        else
+        {
+            BeginPlanning();
+        }
+    }
+
+    /** Stops the operation at the next slice boundary. Renames already made are kept. */
+    void Cancel()
+    {
+        bCancelRequested = true;
+        if (Phase == EPhase::WaitingForRegistry)
+        {
+            IAssetRegistry::GetChecked().OnFilesLoaded().Remove(FilesLoadedHandle);
+            FilesLoadedHandle.Reset();
+            Finish();
+        }
+    }
+
+    /** @return True once the operation has completed or been canceled. */
+    bool IsFinished() const { return Phase == EPhase::Finished; }
+
+private:
+    enum class EPhase : uint8
+    {
+        WaitingForRegistry,
+        Planning,
+        Renaming,
+        Finished,
+    };
+
+    /** Material Instances submitted to a single RenameAssets call per slice. */
+    static constexpr int32 SliceSize = 16;
+
+    void OnFilesLoaded()
+    {
+        IAssetRegistry::GetChecked().OnFilesLoaded().Remove(FilesLoadedHandle);
+        FilesLoadedHandle.Reset();
+        BeginPlanning();
+    }
+
+    /** Queries the registry and plans on a worker thread. The ticker picks up the plan when it is ready. */
+    void BeginPlanning()
+    {
+        // Settings are read here on the game thread; the worker only sees the compiled rules.
+        FRenameRuleTable Rules = FRenameRuleTable::FromSettings(*GetDefault<UMaterialInstanceRenamerSettings>());
+
+        TArray<FAssetData> CandidateAssets;
+        FARFilter Filter;
+        Filter.PackagePaths.Add("/Game");
+        Filter.bRecursivePaths = true;
+        Filter.ClassPaths = Rules.GetClassPaths();
+        {
+            MIRENAMER_TRACE_SCOPE(AssetQuery);
+            IAssetRegistry::GetChecked().GetAssets(Filter, CandidateAssets);
+        }
+
+        if (CandidateAssets.IsEmpty())
+        {
+            Finish();
+            return;
+        }
+
+        SetText(FLocalizationManager::GetText("PlanningRenames"));
+        Phase = EPhase::Planning;
+
+        PlanFuture = Async(EAsyncExecution::ThreadPool,
+            [Assets = MoveTemp(CandidateAssets), Rules = MoveTemp(Rules)]()
+            {
+                FAssetNameIndex NameIndex;
+                FRenamePlan Plan = FAssetRenameUtil::PlanRenames(Assets, Rules, NameIndex);
+                FAssetRenameUtil::GroupRenamesByReferencers(Plan, SliceSize);
+                return Plan;
+            });
+
+        TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateSP(this, &FAsyncRenameAllOperation::Tick));
+    }
+
+    bool Tick(float DeltaTime)
+    {
+        if (Phase == EPhase::Planning)
+        {
+            // A canceled plan is abandoned; the worker finishes on its own and its result is dropped.
+            if (bCancelRequested)
+            {
+                Finish();
+                return false;
+            }
+
+            if (!PlanFuture.IsReady())
+            {
+                return true;
+            }
+
+            Plan = PlanFuture.Consume();
+            Outcomes.Reserve(Plan.Num());
+            Phase = EPhase::Renaming;
+        }
+
+        // Rename slices until this frame's budget is used up. A single slice may exceed the budget.
+        const TConstArrayView<FRenamePlanEntry> Entries = Plan.GetEntries();
+        const double Deadline = FPlatformTime::Seconds() + FrameBudgetSeconds;
+        while (!bCancelRequested && NextEntryIndex < Entries.Num() && FPlatformTime::Seconds() < Deadline)
+        {
+            int32 SliceEnd = NextEntryIndex;
+            int32 NumToRename = 0;
+            while (SliceEnd < Entries.Num() && NumToRename < SliceSize)
+            {
+                if (Entries[SliceEnd].Result == ERenameResult::Renamed)
+                {
+                    NumToRename++;
+                }
+                SliceEnd++;
+            }
+
+            FRenameBatchOptions BatchOptions;
+            BatchOptions.bBulkCheckOut = true;
+
+            TArray<FRenameOutcome> SliceOutcomes;
+            bool bCheckedOut = true;
+            {
+                MIRENAMER_TRACE_SCOPE(RenameSlice);
+                TGuardValue<bool> RenamingGuard(bIsRenamingAsset, true);
+                bCheckedOut = FAssetRenameUtil::ExecuteRenamePlan(Entries.Slice(NextEntryIndex, SliceEnd - NextEntryIndex), SliceOutcomes, BatchOptions);
+            }
+
+            // The remaining slices would fail to check out the same way, so the rename stops as if it was canceled.
+            if (!bCheckedOut)
+            {
+                bCancelRequested = true;
+            }
+            Outcomes.Append(MoveTemp(SliceOutcomes));
+            NextEntryIndex = SliceEnd;
+        }
+
+        if (bCancelRequested || NextEntryIndex >= Entries.Num())
+        {
+            Finish();
+            return false;
+        }
+
+        SetText(FText::Format(FLocalizationManager::GetText("RenamingCount"), FText::AsNumber(NextEntryIndex), FText::AsNumber(Entries.Num())));
+        return true;
+    }
+
+    /** Reports the result in the notification and lets it fade out. */
+    void Finish()
+    {
+        Phase = EPhase::Finished;
+        TickerHandle.Reset();
+
+        // Renames made before a cancellation are kept, so their redirectors are resolved too.
+        FixupRedirectorsIfEnabled(Outcomes);
+
+        int32 RenamedCount = 0, SkippedCount = 0, FailedCount = 0, InvalidPatternCount = 0;
+        for (const FRenameOutcome& Outcome : Outcomes)
+        {
+            switch (Outcome.Result)
+            {
+                case ERenameResult::Renamed: RenamedCount++; break;
+                case ERenameResult::Skipped: SkippedCount++; break;
+                case ERenameResult::Failed: FailedCount++; break;
+                case ERenameResult::InvalidPattern: InvalidPatternCount++; break;
+            }
+        }
+
+        if (!Notification.IsValid())
+        {
+            return;
+        }
+
+        if (Plan.Num() == 0 && !bCancelRequested)
+        {
+            Notification->SetText(FLocalizationManager::GetText("NoAssetsFound"));
+        }
+        else
+        {
+            Notification->SetText(FLocalizationManager::GetText(bCancelRequested ? "RenameCanceled" : "RenameComplete"));
+            Notification->SetSubText(FText::Format(
+                FLocalizationManager::GetText("RenameSummary"),
+                FText::AsNumber(RenamedCount),
+                FText::AsNumber(SkippedCount),
+                FText::AsNumber(FailedCount),
+                FText::AsNumber(InvalidPatternCount)
+            ));
+        }
+        Notification->SetCompletionState(FailedCount > 0 ? SNotificationItem::CS_Fail : SNotificationItem::CS_Success);
+        Notification->ExpireAndFadeout();
+    }
+
+    void SetText(const FText& Text)
+    {
+        if (Notification.IsValid())
+        {
+            Notification->SetText(Text);
+        }
+    }
+
+    EPhase Phase = EPhase::WaitingForRegistry;
+    bool& bIsRenamingAsset;
+    bool bCancelRequested = false;
+    double FrameBudgetSeconds;
+
+    TSharedPtr<SNotificationItem> Notification;
+    FTSTicker::FDelegateHandle TickerHandle;
+    FDelegateHandle FilesLoadedHandle;
+
+    TFuture<FRenamePlan> PlanFuture;
+    FRenamePlan Plan;
+    TArray<FRenameOutcome> Outcomes;
+    int32 NextEntryIndex = 0;
+};
+
 //----------------------------------------------------------------------//
 // FMaterialInstanceRenamerModule Implementation
 //----------------------------------------------------------------------//
 
+/** Auto-renames are flushed once no Material Instance has been added for this long, in seconds. */
+static constexpr double AutoRenameDebounceSeconds = 0.2;
+
 void FMaterialInstanceRenamerModule::StartupModule()
 {
     RegisterSettings();
     if (IsRunningCommandlet()) return;
 
+    const double StartTime = FPlatformTime::Seconds();
     UToolMenus::RegisterStartupCallback(FSimpleMulticastDelegate::FDelegate::CreateRaw(this, &FMaterialInstanceRenamerModule::RegisterMenus));
 
+    // Auto-rename only listens for new assets once the initial scan is done; the scan's own events are never seen.
     FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(AssetRegistryConstants::ModuleName);
-    AssetRegistryModule.Get().OnAssetAdded().AddRaw(this, &FMaterialInstanceRenamerModule::OnAssetAdded);
+    if (AssetRegistryModule.Get().IsLoadingAssets())
+    {
+        FilesLoadedHandle = AssetRegistryModule.Get().OnFilesLoaded().AddRaw(this, &FMaterialInstanceRenamerModule::OnInitialAssetScanCompleted);
+        StartupSeconds = FPlatformTime::Seconds() - StartTime;
+    }
+    else
+    {
+        UpdateAutoRenameBinding();
+        StartupSeconds = FPlatformTime::Seconds() - StartTime;
+        UE_LOG(LogTemp, Log, TEXT("MaterialInstanceRenamer: startup took %.3f ms."), StartupSeconds * 1000.0);
+    }
 }
 
 void FMaterialInstanceRenamerModule::ShutdownModule()
 {
     UnregisterSettings();
+    RenameAllOperation.Reset();
+
+    if (AutoRenameTickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(AutoRenameTickerHandle);
+        AutoRenameTickerHandle.Reset();
+    }
 
     if (UToolMenus::Get())
     {
@@ -230,7 +595,10 @@ void FMaterialInstanceRenamerModule::ShutdownModule()
     {
         FAssetRegistryModule& AssetRegistryModule = FModuleManager::GetModuleChecked<FAssetRegistryModule>(AssetRegistryConstants::ModuleName);
         AssetRegistryModule.Get().OnAssetAdded().RemoveAll(this);
+        AssetRegistryModule.Get().OnFilesLoaded().RemoveAll(this);
     }
+    AssetAddedHandle.Reset();
+    FilesLoadedHandle.Reset();
 }
 
 void FMaterialInstanceRenamerModule::RegisterSettings()
@@ -238,11 +606,16 @@ void FMaterialInstanceRenamerModule::RegisterSettings()
     ISettingsModule* SettingsModule = FModuleManager::GetModulePtr<ISettingsModule>("Settings");
     if (SettingsModule)
     {
-        SettingsModule->RegisterSettings("Project", "Plugins", "MaterialInstanceRenamer",
+        ISettingsSectionPtr SettingsSection = SettingsModule->RegisterSettings("Project", "Plugins", "MaterialInstanceRenamer",
             LOCTEXT("RenamerSettingsName", "Material Instance Renamer"),
             LOCTEXT("RenamerSettingsDescription", "Configure the settings for the Material Instance Renamer plugin."),
             GetMutableDefault<UMaterialInstanceRenamerSettings>()
         );
+
+        if (SettingsSection.IsValid())
+        {
+            SettingsSection->OnModified().BindRaw(this, &FMaterialInstanceRenamerModule::HandleSettingsModified);
+        }
     }
 }
 
@@ -255,6 +628,50 @@ void FMaterialInstanceRenamerModule::UnregisterSettings()
     }
 }
 
+bool FMaterialInstanceRenamerModule::HandleSettingsModified()
+{
+    UpdateAutoRenameBinding();
+    return true;
+}
+
+void FMaterialInstanceRenamerModule::UpdateAutoRenameBinding()
+{
+    if (IsRunningCommandlet() || FilesLoadedHandle.IsValid())
+    {
+        return; // Bound from OnInitialAssetScanCompleted once the initial scan has finished
+    }
+
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(AssetRegistryConstants::ModuleName).Get();
+    const UMaterialInstanceRenamerSettings* Settings = GetDefault<UMaterialInstanceRenamerSettings>();
+    const bool bShouldListen = Settings->bAutoRenameOnCreate;
+
+    // Compiled once per settings change, so OnAssetAdded only looks up the added asset's class path.
+    AutoRenameRules = bShouldListen ? FRenameRuleTable::FromSettings(*Settings) : FRenameRuleTable();
+    if (bShouldListen && !AssetAddedHandle.IsValid())
+    {
+        AssetAddedHandle = AssetRegistry.OnAssetAdded().AddRaw(this, &FMaterialInstanceRenamerModule::OnAssetAdded);
+    }
+    else if (!bShouldListen && AssetAddedHandle.IsValid())
+    {
+        AssetRegistry.OnAssetAdded().Remove(AssetAddedHandle);
+        AssetAddedHandle.Reset();
+    }
+}
+
+void FMaterialInstanceRenamerModule::OnInitialAssetScanCompleted()
+{
+    const double StartTime = FPlatformTime::Seconds();
+    IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(AssetRegistryConstants::ModuleName).Get();
+    AssetRegistry.OnFilesLoaded().Remove(FilesLoadedHandle);
+    FilesLoadedHandle.Reset();
+
+    UpdateAutoRenameBinding();
+
+    // Everything the plugin does before the editor is usable: StartupModule, and binding auto-rename once the scan is done.
+    StartupSeconds += FPlatformTime::Seconds() - StartTime;
+    UE_LOG(LogTemp, Log, TEXT("MaterialInstanceRenamer: initial asset scan finished. Startup took %.3f ms."), StartupSeconds * 1000.0);
+}
+
 void FMaterialInstanceRenamerModule::AddMaterialContextMenuEntry()
 {
     if (!FSlateApplication::IsInitialized()) return;
@@ -270,7 +687,7 @@ void FMaterialInstanceRenamerModule::AddMaterialContextMenuEntry()
         {
             bool bHasMaterialInstance = Algo::AnyOf(Context->SelectedAssets, [](const FAssetData& AssetData)
             {
-                return AssetData.GetClass()->IsChildOf(UMaterialInstanceConstant::StaticClass());
+                return FAssetRenameUtil::IsMaterialInstance(AssetData);
             });
 
             if (bHasMaterialInstance)
@@ -320,17 +737,26 @@ void FMaterialInstanceRenamerModule::AddToolMenuEntry()
                 FUIAction(FExecuteAction::CreateRaw(this, &FMaterialInstanceRenamerModule::OnRenameAllMaterialInstancesClicked))
             );
 
+            SubMenuSection.AddMenuEntry(
+                "EstimateRenameAll",
+                FLocalizationManager::GetText("EstimateRenameAll"),
+                FLocalizationManager::GetText("EstimateRenameAllTooltip"),
+                FSlateIcon(),
+                FUIAction(FExecuteAction::CreateRaw(this, &FMaterialInstanceRenamerModule::OnEstimateRenameAllClicked))
+            );
+
             SubMenuSection.AddMenuEntry(
                 "ToggleAutoRename",
                 FLocalizationManager::GetText("AutoRenameOnCreate"),
                 FLocalizationManager::GetText("AutoRenameOnCreateTooltip"),
                 FSlateIcon(),
                 FUIAction(
-                    FExecuteAction::CreateLambda([]()
+                    FExecuteAction::CreateLambda([this]()
                     {
                         UMaterialInstanceRenamerSettings* Settings = GetMutableDefault<UMaterialInstanceRenamerSettings>();
                         Settings->bAutoRenameOnCreate = !Settings->bAutoRenameOnCreate;
                         Settings->SaveConfig();
+                        UpdateAutoRenameBinding();
                     }),
                     FCanExecuteAction(),
                     FIsActionChecked::CreateLambda([]()
@@ -352,46 +778,78 @@ void FMaterialInstanceRenamerModule::OnRenameAllMaterialInstancesClicked()
         FText::FromString(Settings->RenamePrefix)
     );
 
+    if (RenameAllOperation.IsValid() && !RenameAllOperation->IsFinished())
+    {
+        FMessageDialog::Open(EAppMsgType::Ok, FLocalizationManager::GetText("RenameAlreadyRunning"));
+        return;
+    }
+
     if (FMessageDialog::Open(EAppMsgType::YesNo, ConfirmMessage) != EAppReturnType::Yes)
     {
         return;
     }
 
+    if (Settings->bNonBlockingRenameAll)
+    {
+        RenameAllOperation = MakeShared<FAsyncRenameAllOperation>(bIsRenamingAsset, Settings->NonBlockingFrameBudgetMs);
+        RenameAllOperation->Start();
+        return;
+    }
+
+    RenameAllMaterialInstancesBlocking();
+}
+
+void FMaterialInstanceRenamerModule::RenameAllMaterialInstancesBlocking()
+{
     FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(AssetRegistryConstants::ModuleName);
     IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
 
     TArray<FString> ScanPaths;
     ScanPaths.Add(TEXT("/Game"));
-    AssetRegistry.ScanPathsSynchronous(ScanPaths, true);
+    {
+        MIRENAMER_TRACE_SCOPE(RegistryScan);
+        AssetRegistry.ScanPathsSynchronous(ScanPaths, true);
+    }
 
-    TArray<FAssetData> MaterialInstanceAssets;
+    // One query returns the assets of every handled class; RenameMaterialInstances dispatches them to the rules of their class.
+    TArray<FAssetData> CandidateAssets;
     FARFilter Filter;
     Filter.PackagePaths.Add("/Game");
     Filter.bRecursivePaths = true;
-    Filter.ClassPaths.Add(UMaterialInstanceConstant::StaticClass()->GetClassPathName());
-    AssetRegistry.GetAssets(Filter, MaterialInstanceAssets);
+    Filter.ClassPaths = FRenameRuleTable::FromSettings(*GetDefault<UMaterialInstanceRenamerSettings>()).GetClassPaths();
+    {
+        MIRENAMER_TRACE_SCOPE(AssetQuery);
+        AssetRegistry.GetAssets(Filter, CandidateAssets);
+    }
 
-    if (MaterialInstanceAssets.IsEmpty())
+    if (CandidateAssets.IsEmpty())
     {
         FMessageDialog::Open(EAppMsgType::Ok, FLocalizationManager::GetText("NoAssetsFound"));
         return;
     }
 
-    FScopedSlowTask SlowTask(MaterialInstanceAssets.Num(), FLocalizationManager::GetText("RenamingProgress"));
+    FScopedSlowTask SlowTask(CandidateAssets.Num(), FLocalizationManager::GetText("RenamingProgress"));
     SlowTask.MakeDialog(true);
 
     int32 RenamedCount = 0, SkippedCount = 0, FailedCount = 0, InvalidPatternCount = 0;
 
-    for (const FAssetData& AssetData : MaterialInstanceAssets)
+    FRenameBatchOptions BatchOptions;
+    BatchOptions.bBulkCheckOut = true;
+    int32 LastProcessed = 0;
+    BatchOptions.OnBatchCompleted = [&SlowTask, &LastProcessed](int32 NumProcessed, int32 NumTotal)
     {
-        if (SlowTask.ShouldCancel()) break;
+        SlowTask.EnterProgressFrame(NumProcessed - LastProcessed, FText::Format(LOCTEXT("RenamingBatch", "Renaming {0} / {1}..."), FText::AsNumber(NumProcessed), FText::AsNumber(NumTotal)));
+        LastProcessed = NumProcessed;
+        return !SlowTask.ShouldCancel();
+    };
 
-        FString AssetName = AssetData.AssetName.ToString();
-        SlowTask.EnterProgressFrame(1, FText::Format(LOCTEXT("RenamingAsset", "Renaming {0}..."), FText::FromString(AssetName)));
+    TArray<FRenameOutcome> Outcomes;
+    FAssetRenameUtil::RenameMaterialInstances(CandidateAssets, Outcomes, BatchOptions);
+    FixupRedirectorsIfEnabled(Outcomes);
 
-		FString NewName;
-        const ERenameResult Result = FAssetRenameUtil::RenameMaterialInstance(AssetData, NewName);
-        switch (Result)
+    for (const FRenameOutcome& Outcome : Outcomes)
+    {
+        switch (Outcome.Result)
         {
             case ERenameResult::Renamed: RenamedCount++; break;
             case ERenameResult::Skipped: SkippedCount++; break;
@@ -415,6 +873,55 @@ void FMaterialInstanceRenamerModule::OnRenameAllMaterialInstancesClicked()
 #endif
 }
 
+void FMaterialInstanceRenamerModule::OnEstimateRenameAllClicked()
+{
+    // The estimate never loads a package, so it only needs the registry's discovery to have finished.
+    IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+    if (AssetRegistry.IsLoadingAssets())
+    {
+        FMessageDialog::Open(EAppMsgType::Ok, FLocalizationManager::GetText("WaitingForAssetRegistry"));
+        return;
+    }
+
+    const FRenameRuleTable Rules = FRenameRuleTable::FromSettings(*GetDefault<UMaterialInstanceRenamerSettings>());
+
+    TArray<FAssetData> CandidateAssets;
+    FARFilter Filter;
+    Filter.PackagePaths.Add("/Game");
+    Filter.bRecursivePaths = true;
+    Filter.ClassPaths = Rules.GetClassPaths();
+    {
+        MIRENAMER_TRACE_SCOPE(AssetQuery);
+        AssetRegistry.GetAssets(Filter, CandidateAssets);
+    }
+
+    FAssetNameIndex NameIndex;
+    const FRenamePlan Plan = FAssetRenameUtil::PlanRenames(CandidateAssets, Rules, NameIndex);
+    const FRenameImpactEstimate Estimate = FAssetRenameUtil::EstimateImpact(Plan);
+
+    FRenameThroughput Throughput;
+    Throughput.Load(FRenameThroughput::GetDefaultFilename());
+    const double ProjectedSeconds = Throughput.ProjectSeconds(Estimate);
+    const FText ProjectedText = ProjectedSeconds >= 0.0
+        ? FText::Format(FLocalizationManager::GetText("EstimateProjected"), FText::AsTimespan(FTimespan::FromSeconds(ProjectedSeconds)), FText::AsNumber(Throughput.GetNumRuns()))
+        : FLocalizationManager::GetText("EstimateNoThroughput");
+
+    FText DialogTitle = FLocalizationManager::GetText("EstimateTitle");
+    FText DialogMessage = FText::Format(
+        FLocalizationManager::GetText("EstimateSummary"),
+        FText::AsNumber(Estimate.NumRenames),
+        FText::AsMemory(Estimate.RenamedBytes),
+        FText::AsNumber(Estimate.NumReferencers),
+        FText::AsMemory(Estimate.ReferencerBytes),
+        ProjectedText
+    );
+#if (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 7)
+    FMessageDialog::Open(EAppMsgType::Ok, DialogMessage, &DialogTitle);
+#else
+    FMessageDialog::Open(EAppMsgType::Ok, DialogMessage, DialogTitle);
+#endif
+}
+
 void FMaterialInstanceRenamerModule::RegisterMenus()
 {
 	AddToolMenuEntry();
@@ -423,6 +930,8 @@ void FMaterialInstanceRenamerModule::RegisterMenus()
 
 void FMaterialInstanceRenamerModule::OnAssetAdded(const FAssetData& AssetData)
 {
+	MIRENAMER_TRACE_SCOPE(OnAssetAdded);
+
 	if (bIsRenamingAsset)
 	{
 		return;
@@ -434,28 +943,111 @@ void FMaterialInstanceRenamerModule::OnAssetAdded(const FAssetData& AssetData)
 		return;
 	}
 
-	if (!AssetData.GetClass()->IsChildOf(UMaterialInstanceConstant::StaticClass()))
+	if (!AutoRenameRules.Find(AssetData))
 	{
 		return;
 	}
 
-	bIsRenamingAsset = true;
-	FString NewName;
-	const ERenameResult Result = FAssetRenameUtil::RenameMaterialInstance(AssetData, NewName);
-	bIsRenamingAsset = false;
+	// Renaming inside the registry callback would run once per asset during bulk imports.
+	// Queue the asset instead; the ticker renames everything queued in one batch.
+	PendingAutoRenameAssets.Add(AssetData);
+	LastAutoRenameQueueTime = FPlatformTime::Seconds();
 
-	if (Result == ERenameResult::Renamed && Settings->bShowNotificationOnAutoRename)
+	if (!AutoRenameTickerHandle.IsValid())
 	{
-		FText Message = FText::Format(
-			FLocalizationManager::GetText("AutoRenameNotification"),
-			FText::FromString(AssetData.AssetName.ToString()),
-			FText::FromString(NewName)
-		);
+		AutoRenameTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FMaterialInstanceRenamerModule::TickPendingAutoRenames));
+	}
+}
 
-		FNotificationInfo Info(Message);
-		Info.ExpireDuration = 3.0f;
-		FSlateNotificationManager::Get().AddNotification(Info);
+bool FMaterialInstanceRenamerModule::TickPendingAutoRenames(float DeltaTime)
+{
+	if (FPlatformTime::Seconds() - LastAutoRenameQueueTime < AutoRenameDebounceSeconds)
+	{
+		return true;
 	}
+
+	AutoRenameTickerHandle.Reset();
+	FlushPendingAutoRenames();
+	return false;
+}
+
+void FMaterialInstanceRenamerModule::FlushPendingAutoRenames()
+{
+	MIRENAMER_TRACE_SCOPE(FlushPendingAutoRenames);
+	TArray<FAssetData> QueuedAssets = MoveTemp(PendingAutoRenameAssets);
+	PendingAutoRenameAssets.Reset();
+
+	// Drop duplicates and assets that were deleted or renamed while they were queued.
+	IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+	TSet<FSoftObjectPath> SeenPaths;
+	TArray<FAssetData> AssetsToRename;
+	AssetsToRename.Reserve(QueuedAssets.Num());
+	for (const FAssetData& QueuedAsset : QueuedAssets)
+	{
+		const FSoftObjectPath ObjectPath = QueuedAsset.GetSoftObjectPath();
+		bool bAlreadySeen = false;
+		SeenPaths.Add(ObjectPath, &bAlreadySeen);
+		if (bAlreadySeen)
+		{
+			continue;
+		}
+
+		FAssetData CurrentAsset = AssetRegistry.GetAssetByObjectPath(ObjectPath);
+		if (CurrentAsset.IsValid())
+		{
+			AssetsToRename.Add(MoveTemp(CurrentAsset));
+		}
+	}
+
+	if (AssetsToRename.IsEmpty())
+	{
+		return;
+	}
+
+	FRenameBatchOptions BatchOptions;
+	BatchOptions.bBulkCheckOut = true;
+
+	TArray<FRenameOutcome> Outcomes;
+	{
+		TGuardValue<bool> RenamingGuard(bIsRenamingAsset, true);
+		FAssetRenameUtil::RenameMaterialInstances(AssetsToRename, Outcomes, BatchOptions);
+	}
+
+	const UMaterialInstanceRenamerSettings* Settings = GetDefault<UMaterialInstanceRenamerSettings>();
+	if (!Settings->bShowNotificationOnAutoRename)
+	{
+		return;
+	}
+
+	const FRenameOutcome* LastRenamed = nullptr;
+	int32 RenamedCount = 0;
+	for (const FRenameOutcome& Outcome : Outcomes)
+	{
+		if (Outcome.Result == ERenameResult::Renamed)
+		{
+			LastRenamed = &Outcome;
+			RenamedCount++;
+		}
+	}
+
+	if (RenamedCount == 0)
+	{
+		return;
+	}
+
+	// One notification per flush, however many assets were renamed.
+	FText Message = RenamedCount == 1
+		? FText::Format(
+			FLocalizationManager::GetText("AutoRenameNotification"),
+			FText::FromString(LastRenamed->OldObjectPath.GetAssetName()),
+			FText::FromString(LastRenamed->NewName))
+		: FText::Format(
+			FLocalizationManager::GetText("AutoRenameBatchNotification"),
+			FText::AsNumber(RenamedCount));
+
+	FNotificationInfo Info(Message);
+	Info.ExpireDuration = 3.0f;
+	FSlateNotificationManager::Get().AddNotification(Info);
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -2,13 +2,406 @@
 
 #include "MaterialInstanceRenamerCommandlet.h"
 #include "FAssetRenameUtil.h"
+#include "FAssetNameIndex.h"
+#include "FRenameRuleTable.h"
+#include "FRenameManifest.h"
+#include "FRenameJournal.h"
+#include "FRenameReport.h"
+#include "FRenameSourceControl.h"
+#include "FRenameThroughput.h"
+#include "FRenameWatcher.h"
+#include "MaterialInstanceRenamerTrace.h"
 #include "MaterialInstanceRenamerSettings.h"
 #include "AssetRegistry/AssetRegistryModule.h"
-#include "Materials/MaterialInstanceConstant.h"
 #include "Misc/CommandLine.h"
 #include "Misc/Paths.h"
+#include "Misc/FileHelper.h"
 #include "Misc/Parse.h"
+#include "Misc/PackageName.h"
+#include "Misc/PathViews.h"
+#include "HAL/FileManager.h"
+#include "Misc/Crc.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/App.h"
 #include "UObject/UObjectGlobals.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+#include "FileHelpers.h"
+
+/**
+ * Helpers used by the commandlet's execution stages.
+ */
+namespace MaterialInstanceRenamerCommandlet
+{
+	/** How often -Watch polls for directory changes, in seconds. */
+	static constexpr float WatchPollSeconds = 0.1f;
+
+	/** How long a watched directory has to stay unchanged before its changes are renamed, in seconds. */
+	static constexpr double WatchSettleSeconds = 0.5;
+
+	/** Running totals of the save stage. */
+	struct FSaveStats
+	{
+		int32 NumPackages = 0;
+		int64 NumBytes = 0;
+		double Seconds = 0.0;
+	};
+
+	/**
+	 * Saves every dirty content and map package in one pass: renamed assets, their redirectors and fixed-up referencers.
+	 * Packages are serialised one after another while their files are written on the engine's async writer,
+	 * which is waited on once at the end of the pass. New package files are then marked for add in source control in one operation.
+	 *
+	 * @param InOutStats Receives the number of packages and bytes written and the time spent.
+	 * @return True if all dirty packages were saved.
+	 */
+	static bool SaveDirtyPackages(FSaveStats& InOutStats)
+	{
+		MIRENAMER_TRACE_SCOPE(SavePackages);
+
+		TArray<UPackage*> DirtyPackages;
+		FEditorFileUtils::GetDirtyContentPackages(DirtyPackages);
+		FEditorFileUtils::GetDirtyWorldPackages(DirtyPackages);
+
+		if (DirtyPackages.IsEmpty())
+		{
+			return true;
+		}
+
+		UE_LOG(LogTemp, Display, TEXT("Saving %d dirty packages..."), DirtyPackages.Num());
+		const double StartTime = FPlatformTime::Seconds();
+
+		FSavePackageArgs SaveArgs;
+		SaveArgs.TopLevelFlags = RF_Standalone;
+		SaveArgs.SaveFlags = SAVE_NoError | SAVE_Async;
+		SaveArgs.Error = GWarn;
+
+		bool bAllSaved = true;
+		TArray<FString> SavedFilenames;
+		SavedFilenames.Reserve(DirtyPackages.Num());
+		for (UPackage* Package : DirtyPackages)
+		{
+			const FString Filename = FPackageName::LongPackageNameToFilename(Package->GetName(),
+				Package->ContainsMap() ? FPackageName::GetMapPackageExtension() : FPackageName::GetAssetPackageExtension());
+
+			if (IFileManager::Get().IsReadOnly(*Filename))
+			{
+				UE_LOG(LogTemp, Error, TEXT("Cannot save %s: %s is read-only."), *Package->GetName(), *Filename);
+				bAllSaved = false;
+				continue;
+			}
+
+			if (!UPackage::Save(Package, Package->FindAssetInPackage(), *Filename, SaveArgs).IsSuccessful())
+			{
+				UE_LOG(LogTemp, Error, TEXT("Failed to save %s."), *Package->GetName());
+				bAllSaved = false;
+				continue;
+			}
+			SavedFilenames.Add(Filename);
+		}
+
+		// Every queued write has to land before the files are measured and the packages are released.
+		UPackage::WaitForAsyncFileWrites();
+
+		// New packages are added to source control in one operation; files that are already controlled are left alone.
+		FRenameSourceControl::MarkFilesForAdd(SavedFilenames);
+
+		int64 NumBytes = 0;
+		for (const FString& Filename : SavedFilenames)
+		{
+			NumBytes += FMath::Max<int64>(0, IFileManager::Get().FileSize(*Filename));
+		}
+
+		const double Seconds = FPlatformTime::Seconds() - StartTime;
+		InOutStats.NumPackages += SavedFilenames.Num();
+		InOutStats.NumBytes += NumBytes;
+		InOutStats.Seconds += Seconds;
+		TRACE_COUNTER_ADD(MIRenamer_PackagesSaved, SavedFilenames.Num());
+		INC_DWORD_STAT_BY(STAT_MIRenamer_PackagesSaved, SavedFilenames.Num());
+
+		UE_LOG(LogTemp, Display, TEXT("Saved %d packages (%.1f MB) in %.3f seconds (%.1f MB/s)."),
+			SavedFilenames.Num(), NumBytes / (1024.0 * 1024.0), Seconds, Seconds > 0.0 ? NumBytes / (1024.0 * 1024.0) / Seconds : 0.0);
+		return bAllSaved;
+	}
+
+	/** A package file found on disk. */
+	struct FPackageFile
+	{
+		FString Filename;
+		FName PackageName;
+		FDateTime Timestamp;
+		int64 Size = 0;
+	};
+
+	/**
+	 * Lists every package file below a content path, with its timestamp and size. Reads directory entries only.
+	 *
+	 * @param PackagePath The content path to list (e.g. "/Game").
+	 * @param OutFiles The package files found.
+	 * @return False if the content path could not be mapped to a directory.
+	 */
+	static bool GatherPackageFiles(const FString& PackagePath, TArray<FPackageFile>& OutFiles)
+	{
+		FString Directory;
+		if (!FPackageName::TryConvertLongPackageNameToFilename(PackagePath / TEXT(""), Directory))
+		{
+			return false;
+		}
+
+		const FStringView AssetExtension = FPackageName::GetAssetPackageExtension();
+		const FStringView MapExtension = FPackageName::GetMapPackageExtension();
+		IFileManager::Get().IterateDirectoryStatRecursively(*Directory, [&OutFiles, AssetExtension, MapExtension](const TCHAR* FilenameOrDirectory, const FFileStatData& StatData)
+		{
+			const FStringView Filename(FilenameOrDirectory);
+			if (StatData.bIsDirectory || !(Filename.EndsWith(AssetExtension) || Filename.EndsWith(MapExtension)))
+			{
+				return true;
+			}
+
+			FString PackageName;
+			if (FPackageName::TryConvertFilenameToLongPackageName(FString(Filename), PackageName))
+			{
+				OutFiles.Add({ FString(Filename), FName(PackageName), StatData.ModificationTime, StatData.FileSize });
+			}
+			return true;
+		});
+		return true;
+	}
+
+	/**
+	 * Lists the files changed since a commit with the local git executable, relative to the project directory.
+	 * Uncommitted changes and untracked files are included, so a pre-submit check sees the change as it will be submitted.
+	 *
+	 * @param Commit The revision to compare the working tree against.
+	 * @param OutFiles The changed files, relative to the project directory. Deleted files are listed too.
+	 * @return False if the revision is malformed or git failed.
+	 */
+	static bool GetFilesChangedSinceCommit(const FString& Commit, TArray<FString>& OutFiles)
+	{
+		// The revision is passed on a command line, so only characters that can appear in a revision are accepted,
+		// and a leading '-' is rejected so the revision can never be read by git as an option.
+		bool bValidRevision = !Commit.IsEmpty() && !Commit.StartsWith(TEXT("-"));
+		for (const TCHAR Char : Commit)
+		{
+			bValidRevision &= FChar::IsAlnum(Char) || FCString::Strchr(TEXT("_-./~^@{}"), Char) != nullptr;
+		}
+		if (!bValidRevision)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Invalid revision '%s' for -SinceCommit."), *Commit);
+			return false;
+		}
+
+		const FString ProjectDirectory = FPaths::ConvertRelativePathToFull(FPaths::ProjectDir());
+		const FString GitCommands[] = { FString::Printf(TEXT("diff --name-only --relative %s --"), *Commit), TEXT("ls-files --others --exclude-standard") };
+		for (const FString& GitCommand : GitCommands)
+		{
+			int32 ReturnCode = -1;
+			FString StdOut;
+			FString StdErr;
+			if (!FPlatformProcess::ExecProcess(TEXT("git"), *GitCommand, &ReturnCode, &StdOut, &StdErr, *ProjectDirectory) || ReturnCode != 0)
+			{
+				UE_LOG(LogTemp, Error, TEXT("git %s failed in %s: %s"), *GitCommand, *ProjectDirectory, *StdErr.TrimStartAndEnd());
+				return false;
+			}
+
+			TArray<FString> Lines;
+			StdOut.ParseIntoArrayLines(Lines);
+			OutFiles.Append(MoveTemp(Lines));
+		}
+		return true;
+	}
+
+	/**
+	 * Resolves a list of package files and package names to the existing packages below a content path.
+	 * Filenames may be absolute or relative to the project directory; package names may also be object paths.
+	 * Entries that do not exist any more, are not packages or lie outside the content path are left out.
+	 *
+	 * @param Entries The listed files and packages.
+	 * @param PathToScan The content path of the run (e.g. "/Game").
+	 * @param OutFilenames The package files, one per package.
+	 * @param OutPackageNames The long package names, in the order of OutFilenames.
+	 */
+	static void ResolveListedPackages(TConstArrayView<FString> Entries, const FString& PathToScan, TArray<FString>& OutFilenames, TArray<FName>& OutPackageNames)
+	{
+		const FString PathPrefix = PathToScan.EndsWith(TEXT("/")) ? PathToScan : PathToScan + TEXT("/");
+		const FString ProjectDirectory = FPaths::ConvertRelativePathToFull(FPaths::ProjectDir());
+		const FStringView AssetExtension = FPackageName::GetAssetPackageExtension();
+		const FStringView MapExtension = FPackageName::GetMapPackageExtension();
+
+		TSet<FName> SeenPackages;
+		for (const FString& RawEntry : Entries)
+		{
+			const FString Entry = RawEntry.TrimStartAndEnd();
+			if (Entry.IsEmpty() || Entry.StartsWith(TEXT("#")))
+			{
+				continue;
+			}
+
+			FString PackageName = FPackageName::ObjectPathToPackageName(Entry);
+			FString Filename;
+			if (!FPackageName::IsValidLongPackageName(PackageName) || !FPackageName::DoesPackageExist(PackageName, &Filename))
+			{
+				Filename = FPaths::ConvertRelativePathToFull(ProjectDirectory, Entry);
+				const FStringView Extension = FPathViews::GetExtension(Filename, true);
+				if ((Extension != AssetExtension && Extension != MapExtension) || !IFileManager::Get().FileExists(*Filename)
+					|| !FPackageName::TryConvertFilenameToLongPackageName(Filename, PackageName))
+				{
+					continue;
+				}
+			}
+
+			if (!PackageName.StartsWith(PathPrefix))
+			{
+				continue;
+			}
+
+			bool bAlreadyListed = false;
+			const FName PackageFName(PackageName);
+			SeenPackages.Add(PackageFName, &bAlreadyListed);
+			if (!bAlreadyListed)
+			{
+				OutFilenames.Add(FPaths::ConvertRelativePathToFull(Filename));
+				OutPackageNames.Add(PackageFName);
+			}
+		}
+	}
+
+	/**
+	 * Assigns a package directory to a shard. Depends only on the path string, so every build agent
+	 * computes the same partition, and all assets of a directory land on the same shard.
+	 *
+	 * @param PackagePath The package directory (e.g. "/Game/Materials").
+	 * @param NumShards The total number of shards.
+	 * @return The shard index, in [0, NumShards).
+	 */
+	static int32 GetShardForPackagePath(FName PackagePath, int32 NumShards)
+	{
+		const FString LowerPath = PackagePath.ToString().ToLower();
+		return static_cast<int32>(FCrc::StrCrc32(*LowerPath) % static_cast<uint32>(NumShards));
+	}
+
+	/**
+	 * Scans changed package files and plans the renames of the handled assets in them. The name of every changed
+	 * package is added to the name index first, so a new asset is never renamed onto a name created after its folder was indexed.
+	 *
+	 * @param AssetRegistry The asset registry.
+	 * @param Filenames The changed package files.
+	 * @param Rules The naming rules of the run.
+	 * @param NameIndex The name index of the run, kept across batches.
+	 * @param Shard The shard of the run.
+	 * @param NumShards The number of shards; packages of other shards are ignored.
+	 * @return The plan for the changed packages.
+	 */
+	static FRenamePlan PlanChangedPackages(IAssetRegistry& AssetRegistry, const TArray<FString>& Filenames, const FRenameRuleTable& Rules, FAssetNameIndex& NameIndex, int32 Shard, int32 NumShards)
+	{
+		{
+			MIRENAMER_TRACE_SCOPE(RegistryScan);
+			AssetRegistry.ScanFilesSynchronous(Filenames, true);
+		}
+
+		FARFilter Filter;
+		Filter.ClassPaths = Rules.GetClassPaths();
+		for (const FString& Filename : Filenames)
+		{
+			FString PackageName;
+			if (!FPackageName::TryConvertFilenameToLongPackageName(Filename, PackageName))
+			{
+				continue;
+			}
+
+			const FName PackagePath(FPackageName::GetLongPackagePath(PackageName));
+			if (NumShards > 1 && GetShardForPackagePath(PackagePath, NumShards) != Shard)
+			{
+				continue;
+			}
+
+			// A folder that is not indexed yet is indexed from the registry by PlanRenames, and the registry already knows the package.
+			if (NameIndex.HasPackagePath(PackagePath))
+			{
+				NameIndex.AddName(PackagePath, FName(FPackageName::GetShortName(PackageName)));
+			}
+			Filter.PackageNames.Add(FName(PackageName));
+		}
+
+		TArray<FAssetData> Assets;
+		if (!Filter.PackageNames.IsEmpty())
+		{
+			MIRENAMER_TRACE_SCOPE(AssetQuery);
+			AssetRegistry.GetAssets(Filter, Assets);
+		}
+		return FAssetRenameUtil::PlanRenames(Assets, Rules, NameIndex);
+	}
+
+	/**
+	 * Logs the registry-only impact estimate of a plan and the runtime projected from previous runs.
+	 *
+	 * @param Plan The plan a real run would execute.
+	 * @return The commandlet exit code.
+	 */
+	static int32 LogEstimate(const FRenamePlan& Plan)
+	{
+		const FRenameImpactEstimate Estimate = FAssetRenameUtil::EstimateImpact(Plan);
+		UE_LOG(LogTemp, Display, TEXT("Estimate: %d assets would be renamed (%.1f MB on disk)."),
+			Estimate.NumRenames, Estimate.RenamedBytes / (1024.0 * 1024.0));
+		UE_LOG(LogTemp, Display, TEXT("Estimate: %d referencer packages would be dirtied (%.1f MB on disk)."),
+			Estimate.NumReferencers, Estimate.ReferencerBytes / (1024.0 * 1024.0));
+
+		FRenameThroughput Throughput;
+		Throughput.Load(FRenameThroughput::GetDefaultFilename());
+		const double ProjectedSeconds = Throughput.ProjectSeconds(Estimate);
+		if (ProjectedSeconds >= 0.0)
+		{
+			UE_LOG(LogTemp, Display, TEXT("Estimate: projected runtime %.1f seconds, based on %d previous runs."), ProjectedSeconds, Throughput.GetNumRuns());
+		}
+		else
+		{
+			UE_LOG(LogTemp, Display, TEXT("Estimate: no previous run recorded, so no runtime can be projected. Throughput is recorded by every run that renames assets."));
+		}
+		return 0;
+	}
+
+	/**
+	 * Combines the reports of a sharded run and fails on conflicting results.
+	 *
+	 * @param ReportList Comma-separated list of shard report files.
+	 * @param OutputFilename Optional file the merged report is written to.
+	 * @return The commandlet exit code.
+	 */
+	static int32 MergeReports(const FString& ReportList, const FString& OutputFilename)
+	{
+		TArray<FString> Filenames;
+		ReportList.ParseIntoArray(Filenames, TEXT(","));
+
+		TArray<FRenameReport> Reports;
+		for (const FString& Filename : Filenames)
+		{
+			FRenameReport& Report = Reports.AddDefaulted_GetRef();
+			if (!Report.LoadFromFile(FPaths::ConvertRelativePathToFull(FPaths::ProjectDir(), Filename.TrimStartAndEnd())))
+			{
+				return 1;
+			}
+		}
+
+		FRenameReport Merged;
+		TArray<FString> Conflicts;
+		const bool bNoConflicts = FRenameReport::Merge(Reports, Merged, Conflicts);
+		for (const FString& Conflict : Conflicts)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Conflict: %s"), *Conflict);
+		}
+
+		UE_LOG(LogTemp, Display, TEXT("Merged %d reports with %d assets (%d renamed, %d conflicts)."), Reports.Num(), Merged.Entries.Num(),
+			Algo::CountIf(Merged.Entries, [](const FRenameReport::FEntry& Entry) { return Entry.Result == ERenameResult::Renamed; }), Conflicts.Num());
+
+		if (!OutputFilename.IsEmpty() && !Merged.SaveToFile(OutputFilename))
+		{
+			return 1;
+		}
+		return bNoConflicts ? 0 : 1;
+	}
+}
 
 UMaterialInstanceRenamerCommandlet::UMaterialInstanceRenamerCommandlet()
 {
@@ -20,16 +413,47 @@ UMaterialInstanceRenamerCommandlet::UMaterialInstanceRenamerCommandlet()
 
 int32 UMaterialInstanceRenamerCommandlet::Main(const FString& Params)
 {
+	const double RunStartTime = FPlatformTime::Seconds();
 	UE_LOG(LogTemp, Display, TEXT("Starting Material Instance Renamer Commandlet..."));
 
 	// 1. Parse Command Line Arguments
 	FString PathToScan = TEXT("/Game");
 	FString CustomPrefix;
 	bool bDryRun = false;
+	FRenameBatchOptions BatchOptions;
+
+	// Parse -Report=
+	FString ReportFilename;
+	if (FParse::Value(*Params, TEXT("Report="), ReportFilename))
+	{
+		ReportFilename = FPaths::ConvertRelativePathToFull(FPaths::ProjectDir(), ReportFilename);
+	}
+
+	// Parse -MergeReports=. Merging is a separate mode that touches no assets.
+	FString ReportsToMerge;
+	if (FParse::Value(*Params, TEXT("MergeReports="), ReportsToMerge, false))
+	{
+		return MaterialInstanceRenamerCommandlet::MergeReports(ReportsToMerge, ReportFilename);
+	}
 
 	// Parse -Path=
 	FParse::Value(*Params, TEXT("Path="), PathToScan);
 
+	// Parse -Shard= and -NumShards=
+	int32 Shard = 0;
+	int32 NumShards = 1;
+	FParse::Value(*Params, TEXT("Shard="), Shard);
+	FParse::Value(*Params, TEXT("NumShards="), NumShards);
+	if (NumShards < 1 || Shard < 0 || Shard >= NumShards)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Invalid shard %d of %d. -Shard must be in [0, NumShards)."), Shard, NumShards);
+		return 1;
+	}
+	if (NumShards > 1)
+	{
+		UE_LOG(LogTemp, Display, TEXT("Processing shard %d of %d."), Shard, NumShards);
+	}
+
 	// Parse -Prefix=
 	if (FParse::Value(*Params, TEXT("Prefix="), CustomPrefix))
 	{
@@ -43,6 +467,139 @@ int32 UMaterialInstanceRenamerCommandlet::Main(const FString& Params)
 		UE_LOG(LogTemp, Display, TEXT("Dry Run mode enabled. No changes will be made."));
 	}
 
+	// Parse -Estimate
+	const bool bEstimate = FParse::Param(*Params, TEXT("Estimate"));
+	if (bEstimate)
+	{
+		UE_LOG(LogTemp, Display, TEXT("Estimate mode enabled. Only the asset registry is read."));
+	}
+
+	// Parse -NoSave
+	const bool bNoSave = FParse::Param(*Params, TEXT("NoSave"));
+	if (bNoSave && !bDryRun)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("-NoSave: renamed packages are not saved. They stay dirty in memory until the commandlet exits, so memory is not released between windows."));
+	}
+
+	// Parse -FixupRedirectors
+	bool bFixupRedirectors = FParse::Param(*Params, TEXT("FixupRedirectors"));
+	if (bFixupRedirectors && bNoSave)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("-FixupRedirectors is ignored with -NoSave: no redirector is written to disk."));
+		bFixupRedirectors = false;
+	}
+
+	// Parse -BatchSize=
+	if (FParse::Value(*Params, TEXT("BatchSize="), BatchOptions.BatchSize))
+	{
+		BatchOptions.BatchSize = FMath::Max(1, BatchOptions.BatchSize);
+		UE_LOG(LogTemp, Display, TEXT("Using batch size: %d"), BatchOptions.BatchSize);
+	}
+
+	// With a source control provider (-SCCProvider=), each batch checks out everything it touches in one operation.
+	BatchOptions.bBulkCheckOut = !bNoSave;
+	if (!bDryRun && BatchOptions.bBulkCheckOut && FRenameSourceControl::IsActive())
+	{
+		UE_LOG(LogTemp, Display, TEXT("Source control is active: packages are checked out per batch and new packages are marked for add per window."));
+	}
+
+	if (!bDryRun && FApp::CanEverRender())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Rendering is enabled for this commandlet. Pass -nullrhi so loaded Material Instances skip shader map and texture resource creation."));
+	}
+
+	// Parse -Manifest=
+	FString ManifestFilename;
+	if (FParse::Value(*Params, TEXT("Manifest="), ManifestFilename))
+	{
+		ManifestFilename = FPaths::ConvertRelativePathToFull(FPaths::ProjectDir(), ManifestFilename);
+		UE_LOG(LogTemp, Display, TEXT("Using manifest: %s"), *ManifestFilename);
+	}
+
+	// Parse -MaxLoadedPackages= and -MemoryBudgetMB=
+	int32 MaxLoadedPackages = 2000;
+	int32 MemoryBudgetMB = 0;
+	FParse::Value(*Params, TEXT("MaxLoadedPackages="), MaxLoadedPackages);
+	FParse::Value(*Params, TEXT("MemoryBudgetMB="), MemoryBudgetMB);
+	UE_LOG(LogTemp, Display, TEXT("Processing in windows of up to %d loaded packages (memory budget: %s)."),
+		MaxLoadedPackages, MemoryBudgetMB > 0 ? *FString::Printf(TEXT("%d MB"), MemoryBudgetMB) : TEXT("none"));
+
+	// Parse -Journal= and -Resume
+	FString JournalFilename;
+	if (FParse::Value(*Params, TEXT("Journal="), JournalFilename))
+	{
+		JournalFilename = FPaths::ConvertRelativePathToFull(FPaths::ProjectDir(), JournalFilename);
+	}
+	const bool bResume = FParse::Param(*Params, TEXT("Resume"));
+	if (bResume && JournalFilename.IsEmpty())
+	{
+		UE_LOG(LogTemp, Error, TEXT("-Resume requires -Journal=<File>."));
+		return 1;
+	}
+	if (!JournalFilename.IsEmpty() && (bDryRun || bNoSave))
+	{
+		// Only saved renames are committed to the journal, so these modes have nothing to record.
+		UE_LOG(LogTemp, Warning, TEXT("-Journal is ignored with -DryRun and -NoSave."));
+		JournalFilename.Reset();
+	}
+	const bool bUseJournal = !JournalFilename.IsEmpty();
+	if (bUseJournal)
+	{
+		UE_LOG(LogTemp, Display, TEXT("Using journal: %s%s"), *JournalFilename, bResume ? TEXT(" (resuming)") : TEXT(""));
+	}
+
+	// Parse -TimeBudget=. The run stops at the first batch boundary after the budget is used up.
+	double TimeBudgetSeconds = 0.0;
+	if (FParse::Value(*Params, TEXT("TimeBudget="), TimeBudgetSeconds) && TimeBudgetSeconds > 0.0)
+	{
+		UE_LOG(LogTemp, Display, TEXT("Time budget: %.0f seconds."), TimeBudgetSeconds);
+		if (!bUseJournal)
+		{
+			UE_LOG(LogTemp, Display, TEXT("No journal: work left when the budget runs out is planned again by the next run."));
+		}
+	}
+
+	// Parse -Watch. After the initial pass the commandlet keeps running and renames new and modified packages.
+	const bool bWatch = FParse::Param(*Params, TEXT("Watch"));
+	if (bWatch)
+	{
+		UE_LOG(LogTemp, Display, TEXT("Watch mode enabled. Stop the commandlet with Ctrl+C%s."), TimeBudgetSeconds > 0.0 ? TEXT(" or let the time budget run out") : TEXT(""));
+	}
+
+	// Parse -FileList= and -SinceCommit=. Only the listed packages, and the folders they are in, are scanned.
+	FString FileListFilename;
+	FString SinceCommit;
+	TArray<FString> ListedEntries;
+	if (FParse::Value(*Params, TEXT("FileList="), FileListFilename))
+	{
+		FileListFilename = FPaths::ConvertRelativePathToFull(FPaths::ProjectDir(), FileListFilename);
+		TArray<FString> Lines;
+		if (!FFileHelper::LoadFileToStringArray(Lines, *FileListFilename))
+		{
+			UE_LOG(LogTemp, Error, TEXT("Failed to read file list %s."), *FileListFilename);
+			return 1;
+		}
+		ListedEntries.Append(MoveTemp(Lines));
+	}
+	if (FParse::Value(*Params, TEXT("SinceCommit="), SinceCommit) && !MaterialInstanceRenamerCommandlet::GetFilesChangedSinceCommit(SinceCommit, ListedEntries))
+	{
+		return 1;
+	}
+
+	const bool bUseFileList = !FileListFilename.IsEmpty() || !SinceCommit.IsEmpty();
+	TArray<FString> ListedFilenames;
+	TArray<FName> ListedPackageNames;
+	if (bUseFileList)
+	{
+		MaterialInstanceRenamerCommandlet::ResolveListedPackages(ListedEntries, PathToScan, ListedFilenames, ListedPackageNames);
+		UE_LOG(LogTemp, Display, TEXT("%d listed files resolve to %d packages below %s."), ListedEntries.Num(), ListedPackageNames.Num(), *PathToScan);
+		if (!ManifestFilename.IsEmpty())
+		{
+			UE_LOG(LogTemp, Warning, TEXT("-Manifest is ignored with -FileList and -SinceCommit: it would only record the listed packages."));
+			ManifestFilename.Reset();
+		}
+	}
+
 	// Apply Custom Prefix if provided
 	UMaterialInstanceRenamerSettings* Settings = GetMutableDefault<UMaterialInstanceRenamerSettings>();
 	if (!CustomPrefix.IsEmpty())
@@ -50,84 +607,488 @@ int32 UMaterialInstanceRenamerCommandlet::Main(const FString& Params)
 		Settings->RenamePrefix = CustomPrefix;
 	}
 
+	// The naming rules of every handled class are compiled once for the whole run, after any -Prefix override has been applied.
+	const FRenameRuleTable Rules = FRenameRuleTable::FromSettings(*Settings);
+	FAssetNameIndex NameIndex;
+
+	// A resumed run takes the remaining plan from the journal and skips scanning, querying and classifying.
+	FRenameJournal Journal;
+	const FRenameJournal::FRunKey JournalKey{ Rules.GetFingerprint(), PathToScan, Shard, NumShards };
+	FRenamePlan ResumedPlan;
+	if (bUseJournal && bResume)
+	{
+		if (!Journal.Load(JournalFilename, JournalKey, ResumedPlan))
+		{
+			return 1;
+		}
+		if (ResumedPlan.Num() == 0)
+		{
+			UE_LOG(LogTemp, Display, TEXT("Journal %s has no work left. Nothing to resume."), *JournalFilename);
+			return 0;
+		}
+		if (!ManifestFilename.IsEmpty())
+		{
+			UE_LOG(LogTemp, Warning, TEXT("-Manifest is ignored when resuming: the resumed plan was not scanned by this run."));
+			ManifestFilename.Reset();
+		}
+		if (bUseFileList)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("-FileList and -SinceCommit are ignored when resuming: the journal already holds the plan."));
+		}
+	}
+	const bool bResumed = bUseJournal && bResume;
+
 	UE_LOG(LogTemp, Display, TEXT("Scanning path: %s"), *PathToScan);
 
 	// 2. Asset Registry Initialization
 	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
 	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
 
-	// Scan paths synchronously to ensure assets are found
-	TArray<FString> ScanPaths;
-	ScanPaths.Add(PathToScan);
-	AssetRegistry.ScanPathsSynchronous(ScanPaths, true);
-
-	// 3. Search for Material Instances
-	TArray<FAssetData> MaterialInstanceAssets;
+	// One query returns the assets of every handled class; planning dispatches each asset to the rules of its class.
 	FARFilter Filter;
-	Filter.PackagePaths.Add(FName(*PathToScan));
-	Filter.bRecursivePaths = true;
-	Filter.ClassPaths.Add(UMaterialInstanceConstant::StaticClass()->GetClassPathName());
+	Filter.ClassPaths = Rules.GetClassPaths();
 
-	AssetRegistry.GetAssets(Filter, MaterialInstanceAssets);
+	FRenameReport::FPhaseTimings Phases;
+	const double ScanStartTime = FPlatformTime::Seconds();
 
-	UE_LOG(LogTemp, Display, TEXT("Found %d Material Instances."), MaterialInstanceAssets.Num());
+	// With a manifest, only new or modified packages are scanned; the rest keep their recorded result.
+	FRenameManifest Manifest;
+	int32 UnchangedCount = 0;
+	const bool bUseManifest = !ManifestFilename.IsEmpty();
+	TArray<MaterialInstanceRenamerCommandlet::FPackageFile> PackageFiles;
+	if (bUseManifest && !MaterialInstanceRenamerCommandlet::GatherPackageFiles(PathToScan, PackageFiles))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Path %s is not a mounted content path."), *PathToScan);
+		return 1;
+	}
 
-	if (MaterialInstanceAssets.IsEmpty())
+	if (bUseManifest)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("No Material Instances found in %s"), *PathToScan);
-		return 0; // Success but nothing done
+		FRenameManifest PreviousManifest;
+		PreviousManifest.Load(ManifestFilename, Rules.GetFingerprint());
+
+		TArray<FString> ChangedFilenames;
+		TMap<FName, int32> ShardByPackagePath;
+		int32 ShardPackageCount = 0;
+		for (const MaterialInstanceRenamerCommandlet::FPackageFile& PackageFile : PackageFiles)
+		{
+			// Every package on disk takes part in collision checks, scanned or not.
+			FNameBuilder PackageName(PackageFile.PackageName);
+			const int32 SlashIndex = PackageName.ToView().FindLastChar(TEXT('/'));
+			const FName PackagePath(PackageName.ToView().Left(SlashIndex));
+			NameIndex.AddName(PackagePath, FName(PackageName.ToView().RightChop(SlashIndex + 1)));
+
+			// Packages of other shards are neither scanned nor recorded in this shard's manifest.
+			if (NumShards > 1)
+			{
+				const int32* CachedShard = ShardByPackagePath.Find(PackagePath);
+				const int32 PackageShard = CachedShard ? *CachedShard : ShardByPackagePath.Add(PackagePath, MaterialInstanceRenamerCommandlet::GetShardForPackagePath(PackagePath, NumShards));
+				if (PackageShard != Shard)
+				{
+					continue;
+				}
+			}
+			ShardPackageCount++;
+
+			if (PreviousManifest.IsUpToDate(PackageFile.PackageName, PackageFile.Timestamp, PackageFile.Size))
+			{
+				Manifest.Add(PackageFile.PackageName, *PreviousManifest.Find(PackageFile.PackageName));
+				UnchangedCount++;
+			}
+			else
+			{
+				// Recorded as containing no handled asset until the plan says otherwise.
+				Manifest.Add(PackageFile.PackageName, { PackageFile.Timestamp, PackageFile.Size, FRenameManifest::EPackageState::NoHandledAsset });
+				ChangedFilenames.Add(PackageFile.Filename);
+				Filter.PackageNames.Add(PackageFile.PackageName);
+			}
+		}
+
+		UE_LOG(LogTemp, Display, TEXT("%d of %d packages are unchanged since the last run. Scanning %d packages."),
+			UnchangedCount, ShardPackageCount, ChangedFilenames.Num());
+		MIRENAMER_TRACE_SCOPE(RegistryScan);
+		AssetRegistry.ScanFilesSynchronous(ChangedFilenames);
 	}
+	else if (bUseFileList && !bResumed)
+	{
+		// The other packages in the listed packages' folders are scanned as well, so collision checks see every name there.
+		TSet<FString> Directories;
+		for (const FString& Filename : ListedFilenames)
+		{
+			Directories.Add(FPaths::GetPath(Filename));
+		}
+
+		TArray<FString> FilesToScan;
+		TArray<FString> DirectoryFiles;
+		for (const FString& Directory : Directories)
+		{
+			for (const FString& Extension : { FPackageName::GetAssetPackageExtension(), FPackageName::GetMapPackageExtension() })
+			{
+				DirectoryFiles.Reset();
+				IFileManager::Get().FindFiles(DirectoryFiles, *(Directory / TEXT("*") + Extension), true, false);
+				for (const FString& DirectoryFile : DirectoryFiles)
+				{
+					FilesToScan.Add(Directory / DirectoryFile);
+				}
+			}
+		}
+
+		UE_LOG(LogTemp, Display, TEXT("Scanning %d listed packages and their %d folders (%d packages)."), ListedFilenames.Num(), Directories.Num(), FilesToScan.Num());
+		{
+			MIRENAMER_TRACE_SCOPE(RegistryScan);
+			AssetRegistry.ScanFilesSynchronous(FilesToScan);
+		}
+
+		Filter.PackageNames = ListedPackageNames;
+	}
+	else if (!bResumed)
+	{
+		// Scan paths synchronously to ensure assets are found
+		TArray<FString> ScanPaths;
+		ScanPaths.Add(PathToScan);
+		{
+			MIRENAMER_TRACE_SCOPE(RegistryScan);
+			AssetRegistry.ScanPathsSynchronous(ScanPaths, true);
+		}
+
+		Filter.PackagePaths.Add(FName(*PathToScan));
+		Filter.bRecursivePaths = true;
+	}
+
+	Phases.RegistryScan = FPlatformTime::Seconds() - ScanStartTime;
+
+	// 3. Search for the assets of every handled class
+	const double QueryStartTime = FPlatformTime::Seconds();
+	TArray<FAssetData> CandidateAssets;
+	// A manifest or file list run with nothing to scan must not fall back to querying every handled asset.
+	if (!bResumed && (!(bUseManifest || bUseFileList) || !Filter.PackageNames.IsEmpty()))
+	{
+		MIRENAMER_TRACE_SCOPE(AssetQuery);
+		AssetRegistry.GetAssets(Filter, CandidateAssets);
+	}
+	Phases.Query = FPlatformTime::Seconds() - QueryStartTime;
+
+	UE_LOG(LogTemp, Display, TEXT("Found %d assets of %d handled classes."), CandidateAssets.Num(), Rules.NumClasses());
 
-	// 4. Rename Execution
+	// Keep only the directories of this shard. A manifest run has already left out the packages of other shards.
+	if (NumShards > 1)
+	{
+		TMap<FName, int32> ShardByPackagePath;
+		CandidateAssets.RemoveAll([&ShardByPackagePath, Shard, NumShards](const FAssetData& Asset)
+		{
+			const int32* CachedShard = ShardByPackagePath.Find(Asset.PackagePath);
+			const int32 AssetShard = CachedShard ? *CachedShard : ShardByPackagePath.Add(Asset.PackagePath, MaterialInstanceRenamerCommandlet::GetShardForPackagePath(Asset.PackagePath, NumShards));
+			return AssetShard != Shard;
+		});
+		UE_LOG(LogTemp, Display, TEXT("%d assets belong to shard %d."), CandidateAssets.Num(), Shard);
+	}
+
+	if (CandidateAssets.IsEmpty() && !bResumed)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("No assets to rename found in %s"), *PathToScan);
+	}
+
+	// 4. Plan the renames from registry data only
 	int32 RenamedCount = 0;
 	int32 SkippedCount = 0;
 	int32 FailedCount = 0;
 	int32 InvalidPatternCount = 0;
+	bool bSaveFailed = false;
+	MaterialInstanceRenamerCommandlet::FSaveStats SaveStats;
+	FRedirectorFixupResult FixupResult;
+
+	FRenameReport Report;
+	Report.Path = PathToScan;
+	Report.Shard = Shard;
+	Report.NumShards = NumShards;
+	Report.bDryRun = bDryRun;
+
+	FRenamePlan Plan;
+	if (bResumed)
+	{
+		Plan = MoveTemp(ResumedPlan);
+		UE_LOG(LogTemp, Display, TEXT("Resuming %d assets from the journal (%d to rename, %d committed by previous runs, %d retried after failing)."),
+			Plan.Num(), Plan.CountResult(ERenameResult::Renamed), Journal.GetNumCommitted(), Journal.GetNumRetried());
+	}
+	else
+	{
+		const double PlanStartTime = FPlatformTime::Seconds();
+		Plan = FAssetRenameUtil::PlanRenames(CandidateAssets, Rules, NameIndex);
+		Phases.Planning = FPlatformTime::Seconds() - PlanStartTime;
+		UE_LOG(LogTemp, Display, TEXT("Planned %d assets in %.3f seconds (%d to rename)."),
+			Plan.Num(), Phases.Planning, Plan.CountResult(ERenameResult::Renamed));
+		UE_LOG(LogTemp, Display, TEXT("New names: %d, names kept: %d."), Plan.GetNumNewNames(), Plan.GetNumNamesKept());
+	}
+
+	// Grouping, the estimate, RenameAssets and the redirector fix-up all find referencers through the registry.
+	// A run that scanned only some packages scans the whole path before any of them, once there is something to rename.
+	// A resumed run has scanned nothing at all, and commandlets do not scan the registry on their own.
+	const bool bPartialScan = bUseManifest || bUseFileList || bResumed;
+	if (bPartialScan && Plan.CountResult(ERenameResult::Renamed) > 0)
+	{
+		UE_LOG(LogTemp, Display, TEXT("Scanning %s for the referencers of the planned renames."), *PathToScan);
+		const double ReferencerScanStartTime = FPlatformTime::Seconds();
+		{
+			MIRENAMER_TRACE_SCOPE(RegistryScan);
+			AssetRegistry.ScanPathsSynchronous(TArray<FString>{ PathToScan });
+		}
+		Phases.RegistryScan += FPlatformTime::Seconds() - ReferencerScanStartTime;
+	}
+
+	// Renames sharing a referencer are moved into the same batches, so heavy levels and Blueprints are loaded fewer times.
+	// A resumed plan was already grouped by the run that wrote the journal.
+	if (!bResumed)
+	{
+		const double GroupStartTime = FPlatformTime::Seconds();
+		FAssetRenameUtil::GroupRenamesByReferencers(Plan, BatchOptions.BatchSize);
+		Phases.Planning += FPlatformTime::Seconds() - GroupStartTime;
+	}
 
-	const FString& RecommendedPrefix = Settings->RenamePrefix;
+	const FReferencerFanout& Fanout = Plan.GetReferencerFanout();
+	if (Fanout.NumReferencers > 0)
+	{
+		UE_LOG(LogTemp, Display, TEXT("Referencer fan-out: %d referencers, %d references, heaviest %s (%d renames). Estimated referencer loads: %d (ungrouped: %d)."),
+			Fanout.NumReferencers, Fanout.NumReferences, *Fanout.HeaviestReferencer.ToString(), Fanout.HeaviestReferencerFanout,
+			Fanout.EstimatedLoadsAfter, Fanout.EstimatedLoadsBefore);
+	}
 
-	for (const FAssetData& AssetData : MaterialInstanceAssets)
+	// -Estimate stops here: nothing so far has loaded a package.
+	if (bEstimate)
 	{
-		FString AssetName = AssetData.AssetName.ToString();
+		return MaterialInstanceRenamerCommandlet::LogEstimate(Plan);
+	}
 
-		// Logic for Dry Run to simulate what RenameMaterialInstance does
-		if (bDryRun)
+	// Record the classification of scanned packages. Packages that still need a rename, or failed, are left
+	// out so the next run looks at them again.
+	if (bUseManifest)
+	{
+		for (const FRenamePlanEntry& Entry : Plan.GetEntries())
 		{
-			// Replicate checks from FAssetRenameUtil::RenameMaterialInstance
-			// 1. Check if skipped
-			if (AssetName.StartsWith(RecommendedPrefix) && !AssetName.StartsWith(TEXT("MI_M_")))
+			const FName PackageName = Entry.OldObjectPath.GetLongPackageFName();
+			const FRenameManifest::FEntry* ManifestEntry = Manifest.Find(PackageName);
+			if (!ManifestEntry)
 			{
-				UE_LOG(LogTemp, Display, TEXT("[DryRun] Skipped: %s (Already valid)"), *AssetName);
-				SkippedCount++;
 				continue;
 			}
 
-			// 2. Extract base name
-			FString BaseName;
-			// ExtractBaseName is now public so we can use it
-			// Note: ExtractBaseName reads from GetDefault<UMaterialInstanceRenamerSettings>(), so modifying the CDO earlier works.
-			if (FAssetRenameUtil::ExtractBaseName(AssetName, BaseName))
+			FRenameManifest::FEntry UpdatedEntry = *ManifestEntry;
+			switch (Entry.Result)
 			{
-				FString NewName = RecommendedPrefix + BaseName;
-				UE_LOG(LogTemp, Display, TEXT("[DryRun] Would Rename: %s -> %s"), *AssetName, *NewName);
-				RenamedCount++;
+			case ERenameResult::Skipped:
+				UpdatedEntry.State = FRenameManifest::EPackageState::Conforming;
+				Manifest.Add(PackageName, UpdatedEntry);
+				break;
+			case ERenameResult::InvalidPattern:
+				UpdatedEntry.State = FRenameManifest::EPackageState::InvalidPattern;
+				Manifest.Add(PackageName, UpdatedEntry);
+				break;
+			default:
+				Manifest.Remove(PackageName);
+				break;
 			}
-			else
+		}
+	}
+
+	if (bDryRun)
+	{
+		// Dry run prints the plan as-is, so it always matches what the real run would execute.
+		for (const FRenamePlanEntry& Entry : Plan.GetEntries())
+		{
+			const FNameBuilder AssetName(Entry.OldObjectPath.GetAssetFName());
+			FRenameReport::FEntry& ReportEntry = Report.Entries.Add_GetRef({ Entry.OldObjectPath.ToString(), Entry.Result == ERenameResult::Renamed ? Entry.NewObjectPath.ToString() : FString(), Entry.Result, Entry.Reason });
+			ReportEntry.NumReferencers = Entry.NumReferencers;
+
+			switch (Entry.Result)
 			{
+			case ERenameResult::Renamed:
+				UE_LOG(LogTemp, Display, TEXT("[DryRun] Would Rename: %s -> %s (%d referencers)"), *AssetName, *FNameBuilder(Entry.NewObjectPath.GetAssetFName()), Entry.NumReferencers);
+				RenamedCount++;
+				break;
+			case ERenameResult::Skipped:
+				UE_LOG(LogTemp, Display, TEXT("[DryRun] Skipped: %s (%s)"), *AssetName, Entry.Reason);
+				SkippedCount++;
+				break;
+			case ERenameResult::Failed:
+				UE_LOG(LogTemp, Error, TEXT("[DryRun] Would Fail: %s (%s)"), *AssetName, Entry.Reason);
+				FailedCount++;
+				break;
+			case ERenameResult::InvalidPattern:
 				UE_LOG(LogTemp, Warning, TEXT("[DryRun] Invalid Pattern: %s"), *AssetName);
 				InvalidPatternCount++;
+				break;
 			}
 		}
-		else
+	}
+	else
+	{
+		// 5. Execute the plan in windows: rename up to MaxLoadedPackages assets (or until the memory budget
+		// is exceeded), save, release everything with a garbage collection, and repeat.
+		const TConstArrayView<FRenamePlanEntry> Entries = Plan.GetEntries();
+		TArray<FRenameOutcome> Outcomes;
+		Outcomes.Reserve(Entries.Num());
+
+		// A resumed run starts a new journal for the remaining plan, so window ranges always refer to the plan being executed.
+		if (bUseJournal && !Journal.Begin(JournalFilename, JournalKey, Plan))
+		{
+			return 1;
+		}
+
+		const double Deadline = TimeBudgetSeconds > 0.0 ? RunStartTime + TimeBudgetSeconds : 0.0;
+		bool bTimeBudgetReached = false;
+		bool bCheckOutFailed = false;
+
+		const double ExecuteStartTime = FPlatformTime::Seconds();
+		int32 WindowStart = 0;
+		int32 WindowIndex = 0;
+		while (WindowStart < Entries.Num() && !bTimeBudgetReached)
+		{
+			if (Deadline > 0.0 && FPlatformTime::Seconds() >= Deadline)
+			{
+				bTimeBudgetReached = true;
+				break;
+			}
+
+			// Grow the window until it holds MaxLoadedPackages assets that will actually be loaded
+			int32 WindowEnd = WindowStart;
+			int32 NumToLoad = 0;
+			while (WindowEnd < Entries.Num() && (MaxLoadedPackages <= 0 || NumToLoad < MaxLoadedPackages))
+			{
+				if (Entries[WindowEnd].Result == ERenameResult::Renamed)
+				{
+					NumToLoad++;
+				}
+				WindowEnd++;
+			}
+
+			double WindowPeakUsedMB = 0.0;
+			BatchOptions.OnBatchCompleted = [WindowStart, MemoryBudgetMB, Deadline, NumEntries = Entries.Num(), &WindowPeakUsedMB, &bTimeBudgetReached](int32 NumProcessed, int32 NumTotal)
+			{
+				UE_LOG(LogTemp, Display, TEXT("Processed %d / %d assets."), WindowStart + NumProcessed, NumEntries);
+
+				// Stop at this batch boundary once the time budget is used up; the window is still saved and committed.
+				if (Deadline > 0.0 && FPlatformTime::Seconds() >= Deadline)
+				{
+					bTimeBudgetReached = true;
+					return false;
+				}
+
+				// Close the window early once the budget is exceeded; the next window starts after a garbage collection.
+				const double UsedMB = FPlatformMemory::GetStats().UsedPhysical / (1024.0 * 1024.0);
+				WindowPeakUsedMB = FMath::Max(WindowPeakUsedMB, UsedMB);
+				return MemoryBudgetMB <= 0 || UsedMB < MemoryBudgetMB;
+			};
+
+			if (bUseJournal && !Journal.BeginWindow(WindowStart, WindowEnd))
+			{
+				bSaveFailed = true;
+				break;
+			}
+
+			TArray<FRenameOutcome> WindowOutcomes;
+			bCheckOutFailed = !FAssetRenameUtil::ExecuteRenamePlan(Entries.Slice(WindowStart, WindowEnd - WindowStart), WindowOutcomes, BatchOptions);
+			const int32 NumWindowOutcomes = WindowOutcomes.Num();
+			Outcomes.Append(MoveTemp(WindowOutcomes));
+
+			const double UsedBeforeReleaseMB = FPlatformMemory::GetStats().UsedPhysical / (1024.0 * 1024.0);
+			if (!bNoSave && !MaterialInstanceRenamerCommandlet::SaveDirtyPackages(SaveStats))
+			{
+				UE_LOG(LogTemp, Error, TEXT("Failed to save some packages after window %d."), WindowIndex);
+				bSaveFailed = true;
+			}
+			else if (bUseJournal && !Journal.CommitWindow(WindowStart, TConstArrayView<FRenameOutcome>(Outcomes).Slice(WindowStart, NumWindowOutcomes)))
+			{
+				bSaveFailed = true;
+			}
+			{
+				MIRENAMER_TRACE_SCOPE(ReleaseWindow);
+				CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, true);
+			}
+
+			UE_LOG(LogTemp, Display, TEXT("Window %d: %d assets. Memory: %.1f MB window peak, %.1f MB before release, %.1f MB after release."),
+				WindowIndex, Outcomes.Num() - WindowStart, FMath::Max(WindowPeakUsedMB, UsedBeforeReleaseMB), UsedBeforeReleaseMB,
+				FPlatformMemory::GetStats().UsedPhysical / (1024.0 * 1024.0));
+
+			WindowStart = Outcomes.Num();
+			WindowIndex++;
+
+			// The renames made so far are saved and committed; the remaining windows would fail to check out as well.
+			if (bCheckOutFailed)
+			{
+				break;
+			}
+		}
+		const double ExecuteSeconds = FPlatformTime::Seconds() - ExecuteStartTime;
+
+		// Failed assets are recorded as retryable, so a journal with any of them is not finished.
+		const int32 NumFailedOutcomes = Algo::CountIf(Outcomes, [](const FRenameOutcome& Outcome) { return Outcome.Result == ERenameResult::Failed; });
+		if (Outcomes.Num() < Entries.Num())
+		{
+			UE_LOG(LogTemp, Display, TEXT("Stopped with %d of %d assets left%s."), Entries.Num() - Outcomes.Num(), Entries.Num(),
+				bTimeBudgetReached ? TEXT(" because the time budget was used up") : bCheckOutFailed ? TEXT(" because files could not be checked out") : TEXT(""));
+		}
+		else if (bUseJournal && NumFailedOutcomes == 0)
+		{
+			Journal.Finish();
+		}
+
+		if (bUseJournal && (Outcomes.Num() < Entries.Num() || NumFailedOutcomes > 0))
+		{
+			UE_LOG(LogTemp, Display, TEXT("Run again with -Journal=%s -Resume to continue with the %d assets left and retry the %d that failed."),
+				*JournalFilename, Entries.Num() - Outcomes.Num(), NumFailedOutcomes);
+		}
+
+		// 6. Resolve the redirectors left at the old paths. Each pass covers as many redirectors as a rename window,
+		// so the referencers loaded for the fix-up are released on the same schedule.
+		if (bFixupRedirectors)
+		{
+			TArray<FSoftObjectPath> RenamedPaths;
+			for (const FRenameOutcome& Outcome : Outcomes)
+			{
+				if (Outcome.Result == ERenameResult::Renamed)
+				{
+					RenamedPaths.Add(Outcome.OldObjectPath);
+				}
+			}
+
+			const int32 PassSize = MaxLoadedPackages > 0 ? MaxLoadedPackages : FMath::Max(1, RenamedPaths.Num());
+			for (int32 PassStart = 0; PassStart < RenamedPaths.Num(); PassStart += PassSize)
+			{
+				const TConstArrayView<FSoftObjectPath> PassPaths = TConstArrayView<FSoftObjectPath>(RenamedPaths).Slice(PassStart, FMath::Min(PassSize, RenamedPaths.Num() - PassStart));
+				const FRedirectorFixupResult PassResult = FAssetRenameUtil::FixupRedirectors(PassPaths, false);
+				FixupResult.NumRedirectors += PassResult.NumRedirectors;
+				FixupResult.NumDeleted += PassResult.NumDeleted;
+
+				// AssetTools saves the referencers it fixed up; anything it left dirty is saved here.
+				if (!MaterialInstanceRenamerCommandlet::SaveDirtyPackages(SaveStats))
+				{
+					UE_LOG(LogTemp, Error, TEXT("Failed to save some packages after fixing up redirectors."));
+					bSaveFailed = true;
+				}
+				CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, true);
+			}
+		}
+
+		int32 LoadedCount = 0;
+		double LoadSeconds = 0.0;
+		for (int32 OutcomeIndex = 0; OutcomeIndex < Outcomes.Num(); ++OutcomeIndex)
 		{
-			// Actual Execution
-			FString NewName;
-			ERenameResult Result = FAssetRenameUtil::RenameMaterialInstance(AssetData, NewName);
+			const FRenameOutcome& Outcome = Outcomes[OutcomeIndex];
+			const FNameBuilder AssetName(Outcome.OldObjectPath.GetAssetFName());
+			FRenameReport::FEntry& ReportEntry = Report.Entries.Add_GetRef({ Outcome.OldObjectPath.ToString(), Outcome.Result == ERenameResult::Renamed ? Entries[OutcomeIndex].NewObjectPath.ToString() : FString(), Outcome.Result, Outcome.Reason });
+			ReportEntry.LoadSeconds = Outcome.LoadSeconds;
+			ReportEntry.NumReferencers = Entries[OutcomeIndex].NumReferencers;
+			ReportEntry.RenameSeconds = Outcome.RenameSeconds;
+			Phases.Rename += Outcome.RenameSeconds;
+			if (Outcome.LoadSeconds > 0.0)
+			{
+				LoadedCount++;
+				LoadSeconds += Outcome.LoadSeconds;
+			}
 
-			switch (Result)
+			switch (Outcome.Result)
 			{
 			case ERenameResult::Renamed:
-				UE_LOG(LogTemp, Display, TEXT("Renamed: %s -> %s"), *AssetName, *NewName);
+				UE_LOG(LogTemp, Display, TEXT("Renamed: %s -> %s"), *AssetName, *Outcome.NewName);
 				RenamedCount++;
 				break;
 			case ERenameResult::Skipped:
@@ -137,7 +1098,7 @@ int32 UMaterialInstanceRenamerCommandlet::Main(const FString& Params)
 				SkippedCount++;
 				break;
 			case ERenameResult::Failed:
-				UE_LOG(LogTemp, Error, TEXT("Failed to rename: %s"), *AssetName);
+				UE_LOG(LogTemp, Error, TEXT("Failed to rename: %s (%s)"), *AssetName, Outcome.Reason);
 				FailedCount++;
 				break;
 			case ERenameResult::InvalidPattern:
@@ -146,20 +1107,150 @@ int32 UMaterialInstanceRenamerCommandlet::Main(const FString& Params)
 				break;
 			}
 		}
+
+		Phases.Load = LoadSeconds;
+		Phases.Save = SaveStats.Seconds;
+
+		// Load cost of the run, e.g. to compare runs with and without -nullrhi.
+		const FPlatformMemoryStats MemoryStats = FPlatformMemory::GetStats();
+		UE_LOG(LogTemp, Display, TEXT("Loaded %d assets in %.3f seconds (rename stage %.3f seconds). Peak memory: %.1f MB."),
+			LoadedCount, LoadSeconds, ExecuteSeconds, MemoryStats.PeakUsedPhysical / (1024.0 * 1024.0));
+	}
+
+	// 7. Watch the content directory and rename new and modified packages as they settle. The rules, the name index
+	// and the registry stay in memory, so each change only costs a scan of its own files and a plan of its own assets.
+	int32 WatchedCount = 0;
+	int32 WatchRenamedCount = 0;
+	if (bWatch)
+	{
+		FRenameWatcher Watcher;
+		if (!Watcher.Start(PathToScan))
+		{
+			return 1;
+		}
+
+		BatchOptions.OnBatchCompleted = nullptr;
+		const double WatchDeadline = TimeBudgetSeconds > 0.0 ? RunStartTime + TimeBudgetSeconds : 0.0;
+		double LastPollTime = FPlatformTime::Seconds();
+		TArray<FString> ChangedFilenames;
+		while (!IsEngineExitRequested() && (WatchDeadline <= 0.0 || FPlatformTime::Seconds() < WatchDeadline))
+		{
+			FPlatformProcess::Sleep(MaterialInstanceRenamerCommandlet::WatchPollSeconds);
+			const double PollTime = FPlatformTime::Seconds();
+			const bool bChanged = Watcher.Poll(static_cast<float>(PollTime - LastPollTime), MaterialInstanceRenamerCommandlet::WatchSettleSeconds, ChangedFilenames);
+			LastPollTime = PollTime;
+			if (!bChanged)
+			{
+				continue;
+			}
+
+			MIRENAMER_TRACE_SCOPE(WatchBatch);
+			const FRenamePlan WatchPlan = MaterialInstanceRenamerCommandlet::PlanChangedPackages(AssetRegistry, ChangedFilenames, Rules, NameIndex, Shard, NumShards);
+			WatchedCount += ChangedFilenames.Num();
+			const int32 NumToRename = WatchPlan.CountResult(ERenameResult::Renamed);
+
+			TArray<FRenameOutcome> WatchOutcomes;
+			if (!bDryRun && NumToRename > 0)
+			{
+				FAssetRenameUtil::ExecuteRenamePlan(WatchPlan.GetEntries(), WatchOutcomes, BatchOptions);
+				if (!bNoSave && !MaterialInstanceRenamerCommandlet::SaveDirtyPackages(SaveStats))
+				{
+					UE_LOG(LogTemp, Error, TEXT("Failed to save some packages of watched changes."));
+					bSaveFailed = true;
+				}
+				CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, true);
+			}
+
+			// Packages that already conform, including the ones renamed by this run, are not reported again.
+			for (int32 EntryIndex = 0; EntryIndex < WatchPlan.Num(); ++EntryIndex)
+			{
+				const FRenamePlanEntry& Entry = WatchPlan.GetEntries()[EntryIndex];
+				const ERenameResult Result = WatchOutcomes.IsValidIndex(EntryIndex) ? WatchOutcomes[EntryIndex].Result : Entry.Result;
+				const TCHAR* Reason = WatchOutcomes.IsValidIndex(EntryIndex) ? WatchOutcomes[EntryIndex].Reason : Entry.Reason;
+				const FNameBuilder AssetName(Entry.OldObjectPath.GetAssetFName());
+				switch (Result)
+				{
+				case ERenameResult::Renamed:
+					UE_LOG(LogTemp, Display, TEXT("%s: %s -> %s"), bDryRun ? TEXT("[DryRun] Would Rename") : TEXT("Renamed"), *AssetName, *FNameBuilder(Entry.NewObjectPath.GetAssetFName()));
+					RenamedCount++;
+					WatchRenamedCount++;
+					break;
+				case ERenameResult::Failed:
+					UE_LOG(LogTemp, Error, TEXT("Failed to rename: %s (%s)"), *AssetName, Reason);
+					FailedCount++;
+					break;
+				case ERenameResult::InvalidPattern:
+					UE_LOG(LogTemp, Warning, TEXT("Invalid Pattern: %s"), *AssetName);
+					InvalidPatternCount++;
+					break;
+				default:
+					continue;
+				}
+				Report.Entries.Add({ Entry.OldObjectPath.ToString(), Result == ERenameResult::Renamed ? Entry.NewObjectPath.ToString() : FString(), Result, Reason });
+			}
+
+			UE_LOG(LogTemp, Display, TEXT("Watch: %d changed packages, %d assets planned for renaming, handled in %.1f ms."),
+				ChangedFilenames.Num(), NumToRename, (FPlatformTime::Seconds() - PollTime) * 1000.0);
+		}
+		UE_LOG(LogTemp, Display, TEXT("Stopped watching %s."), *PathToScan);
 	}
 
-	// 5. Result Summary
+	// 8. Result Summary
 	UE_LOG(LogTemp, Display, TEXT("========================================"));
 	UE_LOG(LogTemp, Display, TEXT("Material Instance Renamer Summary"));
 	UE_LOG(LogTemp, Display, TEXT("========================================"));
-	UE_LOG(LogTemp, Display, TEXT("Total Assets Processed: %d"), MaterialInstanceAssets.Num());
+	UE_LOG(LogTemp, Display, TEXT("Total Assets Processed: %d"), Plan.Num());
+	if (bUseManifest)
+	{
+		UE_LOG(LogTemp, Display, TEXT("Unchanged Packages (from manifest): %d"), UnchangedCount);
+	}
+	if (bWatch)
+	{
+		UE_LOG(LogTemp, Display, TEXT("Changed Packages Handled While Watching: %d"), WatchedCount);
+	}
 	UE_LOG(LogTemp, Display, TEXT("Renamed: %d"), RenamedCount);
 	UE_LOG(LogTemp, Display, TEXT("Skipped: %d"), SkippedCount);
 	UE_LOG(LogTemp, Display, TEXT("Failed: %d"), FailedCount);
 	UE_LOG(LogTemp, Display, TEXT("Invalid Pattern: %d"), InvalidPatternCount);
+	if (bFixupRedirectors && !bDryRun)
+	{
+		UE_LOG(LogTemp, Display, TEXT("Redirectors Deleted: %d of %d"), FixupResult.NumDeleted, FixupResult.NumRedirectors);
+	}
+	if (!bDryRun && !bNoSave)
+	{
+		UE_LOG(LogTemp, Display, TEXT("Packages Saved: %d (%.1f MB, %.1f MB/s)"), SaveStats.NumPackages, SaveStats.NumBytes / (1024.0 * 1024.0),
+			SaveStats.Seconds > 0.0 ? SaveStats.NumBytes / (1024.0 * 1024.0) / SaveStats.Seconds : 0.0);
+	}
 	UE_LOG(LogTemp, Display, TEXT("========================================"));
 
-	if (FailedCount > 0)
+	Phases.Total = FPlatformTime::Seconds() - RunStartTime;
+	UE_LOG(LogTemp, Display, TEXT("Phases (seconds): scan %.3f, query %.3f, planning %.3f, load %.3f, rename %.3f, save %.3f, total %.3f."),
+		Phases.RegistryScan, Phases.Query, Phases.Planning, Phases.Load, Phases.Rename, Phases.Save, Phases.Total);
+
+	Report.Phases = Phases;
+	Report.PackagesSaved = SaveStats.NumPackages;
+	Report.BytesSaved = SaveStats.NumBytes;
+	if (!ReportFilename.IsEmpty() && !Report.SaveToFile(ReportFilename))
+	{
+		bSaveFailed = true;
+	}
+
+	// Renamed packages are not recorded under their new names here; they are picked up as new files by the next run.
+	if (bUseManifest && !Manifest.Save(ManifestFilename, Rules.GetFingerprint()))
+	{
+		bSaveFailed = true;
+	}
+
+	// Recorded for the runtime projection of later -Estimate runs. Renames made while watching are not timed by phase, so they are left out.
+	if (!bDryRun && RenamedCount - WatchRenamedCount > 0)
+	{
+		FRenameThroughput Throughput;
+		Throughput.Load(FRenameThroughput::GetDefaultFilename());
+		Throughput.AddRun(RenamedCount - WatchRenamedCount, Phases.Load + Phases.Rename, SaveStats.NumBytes, SaveStats.Seconds);
+		Throughput.Save(FRenameThroughput::GetDefaultFilename());
+	}
+
+	if (FailedCount > 0 || bSaveFailed)
 	{
 		UE_LOG(LogTemp, Error, TEXT("Commandlet finished with errors."));
 		return 1; // Non-zero exit code for failure
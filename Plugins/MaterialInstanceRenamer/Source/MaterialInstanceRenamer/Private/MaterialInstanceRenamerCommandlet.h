@@ -8,14 +8,34 @@
 
 /**
  * Commandlet for renaming Material Instance assets from the command line.
+ * The assets of every class in the plugin's Additional Asset Class Rules are found by the same registry query and renamed in the same pass.
  *
  * Usage:
- *   UnrealEditor-Cmd.exe <ProjectFile> -run=MaterialInstanceRenamer -Prefix=MI_ -DryRun -Path=/Game/Assets
+ *   UnrealEditor-Cmd.exe <ProjectFile> -run=MaterialInstanceRenamer -Prefix=MI_ -DryRun -Path=/Game/Assets -BatchSize=500
  *
  * Parameters:
- *   -Prefix=<String>  : Optional. Custom prefix to use for renaming. Defaults to project settings if not specified.
+ *   -Prefix=<String>  : Optional. Custom prefix to use for renaming Material Instances. Defaults to project settings if not specified.
  *   -DryRun           : Optional. If present, simulates the renaming process without making changes.
  *   -Path=<Path>      : Optional. The content path to scan. Defaults to "/Game".
+ *   -BatchSize=<Int>  : Optional. Number of assets submitted to a single RenameAssets call. Defaults to 500.
+ *   -MaxLoadedPackages=<Int> : Optional. Assets loaded per window before saving and collecting garbage. Defaults to 2000, 0 means unlimited.
+ *   -NoSave                  : Optional. Renames in memory without saving; the changes are kept in memory until exit. For measuring the rename stage alone.
+ *   -Estimate                : Optional. Reports renames, dirtied referencers, their size on disk and a projected runtime from the registry only, then exits.
+ *   -FixupRedirectors        : Optional. After renaming, fixes up referencers of the new redirectors and deletes the ones no longer referenced.
+ *   -MemoryBudgetMB=<Int>    : Optional. Closes the current window early once resident memory exceeds this budget.
+ *   -Manifest=<File>         : Optional. Records checked packages; later runs only scan packages that are new or modified.
+ *   -Shard=<Int> -NumShards=<Int> : Optional. Processes only the package directories assigned to this shard.
+ *   -Report=<File>           : Optional. Writes a JSON (or, for .csv, CSV) report with every asset's result and per-phase and per-asset timings.
+ *   -MergeReports=<Files>    : Optional. Merges comma-separated shard reports into -Report and fails on missing shards or conflicting targets.
+ *   -Journal=<File>          : Optional. Records the plan and every saved window, so an interrupted run can be resumed.
+ *   -Resume                  : Optional. Continues the run recorded in -Journal without scanning or classifying again.
+ *   -TimeBudget=<Seconds>    : Optional. Stops cleanly at the first batch boundary after this many seconds.
+ *   -Watch                   : Optional. After the initial pass, keeps running and renames new and modified packages as they are written.
+ *   -FileList=<File>         : Optional. Scans and classifies only the listed package files or package names, plus their folders for collision checks.
+ *   -SinceCommit=<Revision>  : Optional. Like -FileList, with the files changed since the revision according to the local git.
+ *
+ * Profiling:
+ *   Add -trace=cpu,counters,mirenamer to record every phase of the run in an Unreal Insights trace.
  */
 UCLASS()
 class UMaterialInstanceRenamerCommandlet : public UCommandlet
@@ -6,6 +6,11 @@ UMaterialInstanceRenamerSettings::UMaterialInstanceRenamerSettings()
 {
 	RenamePrefix = TEXT("MI_");
 	SourcePrefix = TEXT("M_");
+	InstanceSuffixes.Add(TEXT("_Inst"));
+	LegacyPrefixes.Add(TEXT("MI_"));
 	bAutoRenameOnCreate = false;
 	bShowNotificationOnAutoRename = false;
+	bNonBlockingRenameAll = false;
+	NonBlockingFrameBudgetMs = 8.0f;
+	bFixupRedirectorsAfterRename = false;
 }
\ No newline at end of file
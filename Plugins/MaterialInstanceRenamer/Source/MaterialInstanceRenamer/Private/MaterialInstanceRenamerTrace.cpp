@@ -0,0 +1,16 @@
+// Copyright 2026 kurorekish. All Rights Reserved.
+
+#include "MaterialInstanceRenamerTrace.h"
+
+UE_TRACE_CHANNEL_DEFINE(MIRenamerChannel);
+
+TRACE_DECLARE_INT_COUNTER(MIRenamer_AssetsClassified, TEXT("MIRenamer/AssetsClassified"));
+TRACE_DECLARE_INT_COUNTER(MIRenamer_AssetsLoaded, TEXT("MIRenamer/AssetsLoaded"));
+TRACE_DECLARE_INT_COUNTER(MIRenamer_AssetsRenamed, TEXT("MIRenamer/AssetsRenamed"));
+TRACE_DECLARE_INT_COUNTER(MIRenamer_PackagesDirtied, TEXT("MIRenamer/PackagesDirtied"));
+TRACE_DECLARE_INT_COUNTER(MIRenamer_PackagesSaved, TEXT("MIRenamer/PackagesSaved"));
+
+DEFINE_STAT(STAT_MIRenamer_AssetsPerSecond);
+DEFINE_STAT(STAT_MIRenamer_AssetsRenamed);
+DEFINE_STAT(STAT_MIRenamer_PackagesDirtied);
+DEFINE_STAT(STAT_MIRenamer_PackagesSaved);
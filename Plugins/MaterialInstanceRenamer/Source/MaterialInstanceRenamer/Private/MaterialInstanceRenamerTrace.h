@@ -0,0 +1,35 @@
+// Copyright 2026 kurorekish. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CountersTrace.h"
+#include "Stats/Stats.h"
+
+/**
+ * Profiling markup for the renamer.
+ *
+ * CPU scopes are emitted on the "MIRenamer" trace channel, so a commandlet run with
+ * -trace=cpu,mirenamer records an Unreal Insights timeline of every renamer phase.
+ * Counters are emitted on the counters channel, and STATGROUP_MIRenamer exposes throughput
+ * and dirtied packages to "stat MIRenamer".
+ */
+UE_TRACE_CHANNEL_EXTERN(MIRenamerChannel);
+
+/** Opens a CPU scope named MIRenamer_<Name> on the MIRenamer trace channel. */
+#define MIRENAMER_TRACE_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(MIRenamer_##Name, MIRenamerChannel)
+
+TRACE_DECLARE_INT_COUNTER_EXTERN(MIRenamer_AssetsClassified);
+TRACE_DECLARE_INT_COUNTER_EXTERN(MIRenamer_AssetsLoaded);
+TRACE_DECLARE_INT_COUNTER_EXTERN(MIRenamer_AssetsRenamed);
+TRACE_DECLARE_INT_COUNTER_EXTERN(MIRenamer_PackagesDirtied);
+TRACE_DECLARE_INT_COUNTER_EXTERN(MIRenamer_PackagesSaved);
+
+DECLARE_STATS_GROUP(TEXT("MIRenamer"), STATGROUP_MIRenamer, STATCAT_Advanced);
+
+DECLARE_FLOAT_COUNTER_STAT_EXTERN(TEXT("Assets Renamed/sec"), STAT_MIRenamer_AssetsPerSecond, STATGROUP_MIRenamer, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Assets Renamed"), STAT_MIRenamer_AssetsRenamed, STATGROUP_MIRenamer, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Packages Dirtied"), STAT_MIRenamer_PackagesDirtied, STATGROUP_MIRenamer, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Packages Saved"), STAT_MIRenamer_PackagesSaved, STATGROUP_MIRenamer, );
@@ -0,0 +1,108 @@
+// Copyright 2026 kurorekish. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "HAL/PlatformTime.h"
+#include "FAssetRenameUtil.h"
+#include "FAssetNameIndex.h"
+#include "FRenameRuleSet.h"
+#include "AssetRegistry/AssetData.h"
+#include "Materials/MaterialInstanceConstant.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Microbenchmark of the naming core over synthetic corpora of 10k, 100k and 1M names.
+ * Reports ns/name and the number of new names built for the single-threaded classifier and for the parallel planner.
+ *
+ * Pass -MIRenamerMaxNsPerName=<Float> to fail the test when the classifier is slower than that,
+ * so CI can catch performance regressions.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMaterialInstanceRenamerBenchmarkTest, "MaterialInstanceRenamer.Benchmark.Classification", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+namespace MaterialInstanceRenamerBenchmark
+{
+	/** Package path used for the synthetic assets; nothing exists there. */
+	static const TCHAR* const CorpusPackagePath = TEXT("/Temp/MaterialInstanceRenamerBenchmark");
+
+	/**
+	 * Builds a corpus with a steady-state mix: 60% already conforming, 30% to rename, 10% invalid.
+	 */
+	static void BuildCorpus(int32 NumNames, TArray<FAssetData>& OutAssets)
+	{
+		const FName PackagePath(CorpusPackagePath);
+		const FTopLevelAssetPath ClassPath = UMaterialInstanceConstant::StaticClass()->GetClassPathName();
+
+		OutAssets.Reset(NumNames);
+		for (int32 Index = 0; Index < NumNames; ++Index)
+		{
+			TStringBuilder<64> AssetName;
+			switch (Index % 10)
+			{
+			case 0:
+			case 1: AssetName << TEXT("M_Asset") << Index << TEXT("_Inst"); break;
+			case 2: AssetName << TEXT("Asset") << Index << TEXT("_Inst"); break;
+			case 3: AssetName << TEXT("Asset") << Index; break;
+			default: AssetName << TEXT("MI_Asset") << Index; break;
+			}
+
+			TStringBuilder<128> PackageName;
+			PackageName << CorpusPackagePath << TEXT('/') << AssetName;
+			OutAssets.Emplace(FName(PackageName.ToView()), PackagePath, FName(AssetName.ToView()), ClassPath);
+		}
+	}
+}
+
+bool FMaterialInstanceRenamerBenchmarkTest::RunTest(const FString& Parameters)
+{
+	using namespace MaterialInstanceRenamerBenchmark;
+
+	double MaxNsPerName = 0.0;
+	FParse::Value(FCommandLine::Get(), TEXT("MIRenamerMaxNsPerName="), MaxNsPerName);
+
+	const FRenameRuleSet Rules(TEXT("MI_"), TEXT("M_"));
+	const int32 CorpusSizes[] = { 10000, 100000, 1000000 };
+
+	TArray<FAssetData> Assets;
+	for (const int32 NumNames : CorpusSizes)
+	{
+		BuildCorpus(NumNames, Assets);
+
+		// 1. Single-threaded classification, the same work PlanRenames does per asset
+		int32 NumNewNames = 0;
+		const double ClassifyStartTime = FPlatformTime::Seconds();
+		for (const FAssetData& Asset : Assets)
+		{
+			const FNameBuilder AssetName(Asset.AssetName);
+			FString NewAssetName;
+			Rules.Classify(AssetName.ToView(), NewAssetName);
+			NumNewNames += NewAssetName.IsEmpty() ? 0 : 1;
+		}
+		const double ClassifyNsPerName = (FPlatformTime::Seconds() - ClassifyStartTime) * 1e9 / NumNames;
+
+		AddInfo(FString::Printf(TEXT("Classify %7d names: %8.1f ns/name, %7d new names"),
+			NumNames, ClassifyNsPerName, NumNewNames));
+
+		// 2. Full parallel planning, including collision resolution
+		FAssetNameIndex NameIndex;
+		const double PlanStartTime = FPlatformTime::Seconds();
+		const FRenamePlan Plan = FAssetRenameUtil::PlanRenames(Assets, Rules, NameIndex);
+		const double PlanNsPerName = (FPlatformTime::Seconds() - PlanStartTime) * 1e9 / NumNames;
+
+		AddInfo(FString::Printf(TEXT("Plan     %7d names: %8.1f ns/name, %7d new names"),
+			NumNames, PlanNsPerName, Plan.GetNumNewNames()));
+
+		TestEqual(TEXT("Planned entries"), Plan.Num(), NumNames);
+		TestEqual(TEXT("New names built by the classifier and the planner"), Plan.GetNumNewNames(), NumNewNames);
+
+		if (MaxNsPerName > 0.0 && ClassifyNsPerName > MaxNsPerName)
+		{
+			AddError(FString::Printf(TEXT("Classification of %d names took %.1f ns/name, above the limit of %.1f ns/name."), NumNames, ClassifyNsPerName, MaxNsPerName));
+		}
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
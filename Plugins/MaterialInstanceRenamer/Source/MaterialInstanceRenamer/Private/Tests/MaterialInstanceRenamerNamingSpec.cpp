@@ -0,0 +1,410 @@
+// Copyright 2026 kurorekish. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+#include "FAssetRenameUtil.h"
+#include "FAssetNameIndex.h"
+#include "FRenameRuleSet.h"
+#include "FRenameRuleTable.h"
+#include "FRenameSourceControl.h"
+#include "FRenameReport.h"
+#include "FRenameJournal.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+#include "AssetRegistry/AssetData.h"
+#include "Materials/Material.h"
+#include "Materials/MaterialInstanceConstant.h"
+#include "Engine/Texture2D.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+BEGIN_DEFINE_SPEC(FMaterialInstanceRenamerNamingSpec, "MaterialInstanceRenamer.Naming", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+	/** Package path used for synthetic assets; nothing exists there, so the registry never reports collisions. */
+	const FName TestPackagePath = TEXT("/Temp/MaterialInstanceRenamerSpec");
+
+	/** Classifies a name and returns the new name, or the result as text if no rename is needed. */
+	FString Classify(const FRenameRuleSet& Rules, const TCHAR* AssetName)
+	{
+		FString NewAssetName;
+		switch (Rules.Classify(AssetName, NewAssetName))
+		{
+		case ERenameResult::Renamed: return NewAssetName;
+		case ERenameResult::Skipped: return TEXT("<Skipped>");
+		case ERenameResult::InvalidPattern: return TEXT("<InvalidPattern>");
+		default: return TEXT("<Failed>");
+		}
+	}
+
+	/** Extracts the base name, or returns "<NoMatch>". */
+	FString Extract(const FRenameRuleSet& Rules, const TCHAR* AssetName)
+	{
+		FStringView BaseName;
+		return Rules.ExtractBaseName(AssetName, BaseName) ? FString(BaseName) : FString(TEXT("<NoMatch>"));
+	}
+
+	/** Creates registry data for a Material Instance that does not exist on disk. */
+	FAssetData MakeAssetData(const TCHAR* AssetName) const
+	{
+		return MakeAssetData(AssetName, UMaterialInstanceConstant::StaticClass());
+	}
+
+	/** Creates registry data for an asset of the given class that does not exist on disk. */
+	FAssetData MakeAssetData(const TCHAR* AssetName, const UClass* AssetClass) const
+	{
+		const FName PackageName(*FString::Printf(TEXT("%s/%s"), *TestPackagePath.ToString(), AssetName));
+		return FAssetData(PackageName, TestPackagePath, FName(AssetName), AssetClass->GetClassPathName());
+	}
+
+END_DEFINE_SPEC(FMaterialInstanceRenamerNamingSpec)
+
+void FMaterialInstanceRenamerNamingSpec::Define()
+{
+	Describe("ExtractBaseName", [this]()
+	{
+		const FRenameRuleSet DefaultRules(TEXT("MI_"), TEXT("M_"));
+		const FRenameRuleSet CustomRules(TEXT("P_"), TEXT("M_"));
+
+		It("strips the rename prefix, the source prefix and the suffix", [this, DefaultRules]()
+		{
+			TestEqual(TEXT("MI_M_Rock_Inst"), Extract(DefaultRules, TEXT("MI_M_Rock_Inst")), TEXT("Rock"));
+		});
+
+		It("strips the rename prefix and the source prefix", [this, DefaultRules]()
+		{
+			TestEqual(TEXT("MI_M_Rock"), Extract(DefaultRules, TEXT("MI_M_Rock")), TEXT("Rock"));
+		});
+
+		It("strips the legacy MI_ prefix and the source prefix when a custom prefix is used", [this, CustomRules]()
+		{
+			TestEqual(TEXT("MI_M_Rock_Inst"), Extract(CustomRules, TEXT("MI_M_Rock_Inst")), TEXT("Rock"));
+			TestEqual(TEXT("MI_M_Rock"), Extract(CustomRules, TEXT("MI_M_Rock")), TEXT("Rock"));
+		});
+
+		It("strips the source prefix and the suffix", [this, DefaultRules]()
+		{
+			TestEqual(TEXT("M_Rock_Inst"), Extract(DefaultRules, TEXT("M_Rock_Inst")), TEXT("Rock"));
+		});
+
+		It("strips the source prefix alone", [this, DefaultRules]()
+		{
+			TestEqual(TEXT("M_Rock"), Extract(DefaultRules, TEXT("M_Rock")), TEXT("Rock"));
+		});
+
+		It("strips the suffix alone", [this, DefaultRules]()
+		{
+			TestEqual(TEXT("Rock_Inst"), Extract(DefaultRules, TEXT("Rock_Inst")), TEXT("Rock"));
+		});
+
+		It("matches prefixes and suffixes case-insensitively", [this, DefaultRules]()
+		{
+			TestEqual(TEXT("m_Rock_inst"), Extract(DefaultRules, TEXT("m_Rock_inst")), TEXT("Rock"));
+		});
+
+		It("does not match a name without any known prefix or suffix", [this, DefaultRules]()
+		{
+			TestEqual(TEXT("Rock"), Extract(DefaultRules, TEXT("Rock")), TEXT("<NoMatch>"));
+		});
+
+		It("never produces an empty base name", [this, DefaultRules]()
+		{
+			TestEqual(TEXT("M_Inst"), Extract(DefaultRules, TEXT("M_Inst")), TEXT("Inst"));
+			TestEqual(TEXT("_Inst"), Extract(DefaultRules, TEXT("_Inst")), TEXT("<NoMatch>"));
+		});
+
+		It("honours a custom source prefix", [this]()
+		{
+			const FRenameRuleSet Rules(TEXT("MI_"), TEXT("MM_"));
+			TestEqual(TEXT("MM_Floor"), Extract(Rules, TEXT("MM_Floor")), TEXT("Floor"));
+			TestEqual(TEXT("M_Floor"), Extract(Rules, TEXT("M_Floor")), TEXT("<NoMatch>"));
+		});
+
+		It("uses every configured source prefix, suffix and legacy prefix", [this]()
+		{
+			const TArray<FString> SourcePrefixes = { TEXT("M_"), TEXT("MM_") };
+			const TArray<FString> Suffixes = { TEXT("_Inst"), TEXT("_MI"), TEXT("_Instance") };
+			const TArray<FString> LegacyPrefixes = { TEXT("MI_"), TEXT("MatInst_") };
+			const FRenameRuleSet Rules(TEXT("P_"), SourcePrefixes, Suffixes, LegacyPrefixes);
+
+			TestEqual(TEXT("MM_Rock_Instance"), Extract(Rules, TEXT("MM_Rock_Instance")), TEXT("Rock"));
+			TestEqual(TEXT("M_Rock_MI"), Extract(Rules, TEXT("M_Rock_MI")), TEXT("Rock"));
+			TestEqual(TEXT("MatInst_MM_Rock"), Extract(Rules, TEXT("MatInst_MM_Rock")), TEXT("Rock"));
+		});
+	});
+
+	Describe("Classify", [this]()
+	{
+		const FRenameRuleSet DefaultRules(TEXT("MI_"), TEXT("M_"));
+		const FRenameRuleSet CustomRules(TEXT("P_"), TEXT("M_"));
+
+		It("skips names that already have the rename prefix", [this, DefaultRules]()
+		{
+			TestEqual(TEXT("MI_Rock"), Classify(DefaultRules, TEXT("MI_Rock")), TEXT("<Skipped>"));
+			TestEqual(TEXT("MI_Rock_Inst"), Classify(DefaultRules, TEXT("MI_Rock_Inst")), TEXT("<Skipped>"));
+		});
+
+		It("renames MI_M_ names even though they start with the rename prefix", [this, DefaultRules]()
+		{
+			TestEqual(TEXT("MI_M_Rock"), Classify(DefaultRules, TEXT("MI_M_Rock")), TEXT("MI_Rock"));
+			TestEqual(TEXT("MI_M_Rock_Inst"), Classify(DefaultRules, TEXT("MI_M_Rock_Inst")), TEXT("MI_Rock"));
+		});
+
+		It("renames every supported pattern to the rename prefix", [this, DefaultRules]()
+		{
+			TestEqual(TEXT("M_Rock_Inst"), Classify(DefaultRules, TEXT("M_Rock_Inst")), TEXT("MI_Rock"));
+			TestEqual(TEXT("M_Rock"), Classify(DefaultRules, TEXT("M_Rock")), TEXT("MI_Rock"));
+			TestEqual(TEXT("Rock_Inst"), Classify(DefaultRules, TEXT("Rock_Inst")), TEXT("MI_Rock"));
+		});
+
+		It("reports names without a known pattern as invalid", [this, DefaultRules]()
+		{
+			TestEqual(TEXT("Rock"), Classify(DefaultRules, TEXT("Rock")), TEXT("<InvalidPattern>"));
+			TestEqual(TEXT("T_Rock"), Classify(DefaultRules, TEXT("T_Rock")), TEXT("<InvalidPattern>"));
+		});
+
+		It("uses a custom rename prefix", [this, CustomRules]()
+		{
+			TestEqual(TEXT("P_Rock"), Classify(CustomRules, TEXT("P_Rock")), TEXT("<Skipped>"));
+			TestEqual(TEXT("M_Rock_Inst"), Classify(CustomRules, TEXT("M_Rock_Inst")), TEXT("P_Rock"));
+			TestEqual(TEXT("P_M_Rock"), Classify(CustomRules, TEXT("P_M_Rock")), TEXT("<Skipped>"));
+			TestEqual(TEXT("MI_M_Rock_Inst"), Classify(CustomRules, TEXT("MI_M_Rock_Inst")), TEXT("P_Rock"));
+		});
+	});
+
+	Describe("PlanRenames", [this]()
+	{
+		const FRenameRuleSet DefaultRules(TEXT("MI_"), TEXT("M_"));
+
+		It("plans one entry per asset with the classified result", [this, DefaultRules]()
+		{
+			const TArray<FAssetData> Assets = { MakeAssetData(TEXT("M_Rock_Inst")), MakeAssetData(TEXT("MI_Sand")), MakeAssetData(TEXT("Grass")) };
+			FAssetNameIndex NameIndex;
+			const FRenamePlan Plan = FAssetRenameUtil::PlanRenames(Assets, DefaultRules, NameIndex);
+
+			if (TestEqual(TEXT("Num"), Plan.Num(), 3))
+			{
+				TestTrue(TEXT("Renamed"), Plan.GetEntries()[0].Result == ERenameResult::Renamed);
+				TestEqual(TEXT("New name"), Plan.GetEntries()[0].NewObjectPath.GetAssetName(), TEXT("MI_Rock"));
+				TestTrue(TEXT("Skipped"), Plan.GetEntries()[1].Result == ERenameResult::Skipped);
+				TestTrue(TEXT("InvalidPattern"), Plan.GetEntries()[2].Result == ERenameResult::InvalidPattern);
+			}
+		});
+
+		It("resolves collisions between assets of the same plan deterministically", [this, DefaultRules]()
+		{
+			const TArray<FAssetData> Assets = { MakeAssetData(TEXT("Rock_Inst")), MakeAssetData(TEXT("M_Rock_Inst")) };
+			FAssetNameIndex NameIndex;
+			const FRenamePlan Plan = FAssetRenameUtil::PlanRenames(Assets, DefaultRules, NameIndex);
+
+			// Suffixes are assigned in package name order, whatever the input order.
+			TestEqual(TEXT("Rock_Inst"), Plan.GetEntries()[0].NewObjectPath.GetAssetName(), TEXT("MI_Rock1"));
+			TestEqual(TEXT("M_Rock_Inst"), Plan.GetEntries()[1].NewObjectPath.GetAssetName(), TEXT("MI_Rock"));
+		});
+
+		It("avoids names that already exist in the folder", [this, DefaultRules]()
+		{
+			const TArray<FAssetData> Assets = { MakeAssetData(TEXT("M_Rock_Inst")) };
+			FAssetNameIndex NameIndex;
+			NameIndex.AddName(TestPackagePath, TEXT("MI_Rock"));
+			NameIndex.AddName(TestPackagePath, TEXT("MI_Rock1"));
+			const FRenamePlan Plan = FAssetRenameUtil::PlanRenames(Assets, DefaultRules, NameIndex);
+
+			TestEqual(TEXT("M_Rock_Inst"), Plan.GetEntries()[0].NewObjectPath.GetAssetName(), TEXT("MI_Rock2"));
+		});
+
+		It("builds no new names for skipped or invalid assets", [this, DefaultRules]()
+		{
+			const TArray<FAssetData> Assets = { MakeAssetData(TEXT("MI_Rock")), MakeAssetData(TEXT("MI_Sand")), MakeAssetData(TEXT("Grass")) };
+			FAssetNameIndex NameIndex;
+			const FRenamePlan Plan = FAssetRenameUtil::PlanRenames(Assets, DefaultRules, NameIndex);
+
+			TestEqual(TEXT("New names"), Plan.GetNumNewNames(), 0);
+			TestEqual(TEXT("Names kept"), Plan.GetNumNamesKept(), 3);
+		});
+	});
+
+	Describe("RuleTable", [this]()
+	{
+		It("dispatches every asset to the rules of its class in one plan", [this]()
+		{
+			FRenameRuleTable Rules;
+			Rules.Add(UMaterialInstanceConstant::StaticClass()->GetClassPathName(), FRenameRuleSet(TEXT("MI_"), TEXT("M_")));
+			Rules.Add(UTexture2D::StaticClass()->GetClassPathName(), FRenameRuleSet(TEXT("T_"), TArray<FString>{ TEXT("Tex_") }, TArray<FString>(), TArray<FString>()), false);
+
+			const TArray<FAssetData> Assets = { MakeAssetData(TEXT("M_Rock_Inst")), MakeAssetData(TEXT("Tex_Rock"), UTexture2D::StaticClass()), MakeAssetData(TEXT("M_Rock"), UMaterial::StaticClass()) };
+			FAssetNameIndex NameIndex;
+			const FRenamePlan Plan = FAssetRenameUtil::PlanRenames(Assets, Rules, NameIndex);
+
+			if (TestEqual(TEXT("Num"), Plan.Num(), 3))
+			{
+				TestEqual(TEXT("Material Instance"), Plan.GetEntries()[0].NewObjectPath.GetAssetName(), TEXT("MI_Rock"));
+				TestEqual(TEXT("Texture"), Plan.GetEntries()[1].NewObjectPath.GetAssetName(), TEXT("T_Rock"));
+				TestTrue(TEXT("Class without rules is skipped"), Plan.GetEntries()[2].Result == ERenameResult::Skipped);
+			}
+		});
+
+		It("keeps the rules of an explicitly added subclass", [this]()
+		{
+			AddExpectedError(TEXT("overlap"), EAutomationExpectedErrorFlags::Contains, 1);
+
+			FRenameRuleTable Rules;
+			Rules.Add(UMaterialInterface::StaticClass()->GetClassPathName(), FRenameRuleSet(TEXT("MAT_"), TEXT("")));
+			Rules.Add(UMaterialInstanceConstant::StaticClass()->GetClassPathName(), FRenameRuleSet(TEXT("MI_"), TEXT("M_")));
+
+			const FRenameRuleSet* InstanceRules = Rules.Find(UMaterialInstanceConstant::StaticClass()->GetClassPathName());
+			const FRenameRuleSet* MaterialRules = Rules.Find(UMaterial::StaticClass()->GetClassPathName());
+			TestTrue(TEXT("Material Instance rules"), InstanceRules && InstanceRules->GetRenamePrefix() == TEXT("MI_"));
+			TestTrue(TEXT("Subclass rules"), MaterialRules && MaterialRules->GetRenamePrefix() == TEXT("MAT_"));
+		});
+
+		It("gives a subclass of two overlapping classes the rules of the nearest one in either order", [this]()
+		{
+			AddExpectedError(TEXT("overlap"), EAutomationExpectedErrorFlags::Contains, 2);
+
+			for (const bool bBaseFirst : { true, false })
+			{
+				FRenameRuleTable Rules;
+				if (bBaseFirst)
+				{
+					Rules.Add(UMaterialInterface::StaticClass()->GetClassPathName(), FRenameRuleSet(TEXT("MAT_"), TEXT("")));
+				}
+				Rules.Add(UMaterialInstance::StaticClass()->GetClassPathName(), FRenameRuleSet(TEXT("MI_"), TEXT("M_")));
+				if (!bBaseFirst)
+				{
+					Rules.Add(UMaterialInterface::StaticClass()->GetClassPathName(), FRenameRuleSet(TEXT("MAT_"), TEXT("")));
+				}
+
+				const FRenameRuleSet* NearestRules = Rules.Find(UMaterialInstanceConstant::StaticClass()->GetClassPathName());
+				const FRenameRuleSet* BaseRules = Rules.Find(UMaterial::StaticClass()->GetClassPathName());
+				TestTrue(TEXT("Nearest class rules"), NearestRules && NearestRules->GetRenamePrefix() == TEXT("MI_"));
+				TestTrue(TEXT("Base class rules"), BaseRules && BaseRules->GetRenamePrefix() == TEXT("MAT_"));
+			}
+		});
+	});
+
+	Describe("SourceControl", [this]()
+	{
+		It("gathers the renamed, referencing and new packages of a batch once each", [this]()
+		{
+			const TArray<FAssetData> Assets = { MakeAssetData(TEXT("M_Rock_Inst")), MakeAssetData(TEXT("M_Sand_Inst")), MakeAssetData(TEXT("MI_Grass")) };
+			FAssetNameIndex NameIndex;
+			const FRenamePlan Plan = FAssetRenameUtil::PlanRenames(Assets, FRenameRuleSet(TEXT("MI_"), TEXT("M_")), NameIndex);
+
+			// Both renames share a level; the sand instance is also referenced by the rock instance.
+			const FName Level = TEXT("/Temp/MaterialInstanceRenamerSpec/Level");
+			const FName Rock = Assets[0].PackageName;
+			const FRenameSourceControl::FBatchPackages Packages = FRenameSourceControl::GatherBatchPackages(Plan.GetEntries(), [Level, Rock](FName PackageName, TArray<FName>& OutReferencers)
+			{
+				OutReferencers.Add(Level);
+				if (PackageName != Rock)
+				{
+					OutReferencers.Add(Rock);
+				}
+			});
+
+			const TArray<FString> ExpectedCheckOut = { Assets[0].PackageName.ToString(), Assets[1].PackageName.ToString(), Level.ToString() };
+			const TArray<FString> ExpectedAdd = { TEXT("/Temp/MaterialInstanceRenamerSpec/MI_Rock"), TEXT("/Temp/MaterialInstanceRenamerSpec/MI_Sand") };
+			TestTrue(TEXT("Packages to check out"), Packages.PackagesToCheckOut == ExpectedCheckOut);
+			TestTrue(TEXT("Packages to add"), Packages.PackagesToAdd == ExpectedAdd);
+		});
+	});
+
+	Describe("Report", [this]()
+	{
+		It("merges only the complete set of shards of one run", [this]()
+		{
+			auto MakeReport = [](int32 Shard, int32 NumShards)
+			{
+				FRenameReport Report;
+				Report.Shard = Shard;
+				Report.NumShards = NumShards;
+				return Report;
+			};
+
+			FRenameReport Merged;
+			TArray<FString> Conflicts;
+			TestTrue(TEXT("Complete"), FRenameReport::Merge({ MakeReport(1, 2), MakeReport(0, 2) }, Merged, Conflicts));
+
+			Conflicts.Reset();
+			TestFalse(TEXT("Missing shard"), FRenameReport::Merge({ MakeReport(0, 3), MakeReport(2, 3) }, Merged, Conflicts));
+
+			Conflicts.Reset();
+			TestFalse(TEXT("Duplicate shard"), FRenameReport::Merge({ MakeReport(0, 2), MakeReport(0, 2), MakeReport(1, 2) }, Merged, Conflicts));
+
+			Conflicts.Reset();
+			TestFalse(TEXT("Different shard counts"), FRenameReport::Merge({ MakeReport(0, 2), MakeReport(1, 3) }, Merged, Conflicts));
+		});
+	});
+
+	Describe("Journal", [this]()
+	{
+		It("retries the failed entries of a committed window on resume", [this]()
+		{
+			const TArray<FAssetData> Assets = { MakeAssetData(TEXT("M_Rock_Inst")), MakeAssetData(TEXT("M_Sand_Inst")), MakeAssetData(TEXT("M_Grass_Inst")) };
+			FAssetNameIndex NameIndex;
+			const FRenamePlan Plan = FAssetRenameUtil::PlanRenames(Assets, FRenameRuleSet(TEXT("MI_"), TEXT("M_")), NameIndex);
+
+			TArray<FRenameOutcome> Outcomes;
+			for (const FRenamePlanEntry& Entry : Plan.GetEntries())
+			{
+				FRenameOutcome& Outcome = Outcomes.AddDefaulted_GetRef();
+				Outcome.OldObjectPath = Entry.OldObjectPath;
+				Outcome.Result = ERenameResult::Renamed;
+			}
+			Outcomes[1].Result = ERenameResult::Failed;
+
+			const FString Filename = FPaths::AutomationTransientDir() / TEXT("MaterialInstanceRenamerSpec.journal");
+			const FRenameJournal::FRunKey Key{ 0, TestPackagePath.ToString(), 0, 1 };
+			FRenameJournal Journal;
+			TestTrue(TEXT("Begin"), Journal.Begin(Filename, Key, Plan));
+			TestTrue(TEXT("BeginWindow"), Journal.BeginWindow(0, Plan.Num()));
+			TestTrue(TEXT("CommitWindow"), Journal.CommitWindow(0, Outcomes));
+
+			FRenamePlan Remaining;
+			FRenameJournal ResumedJournal;
+			if (TestTrue(TEXT("Load"), ResumedJournal.Load(Filename, Key, Remaining)) && TestEqual(TEXT("Remaining"), Remaining.Num(), 1))
+			{
+				TestEqual(TEXT("Failed entry is retried"), Remaining.GetEntries()[0].OldObjectPath.ToString(), Assets[1].GetSoftObjectPath().ToString());
+				TestTrue(TEXT("Still planned as a rename"), Remaining.GetEntries()[0].Result == ERenameResult::Renamed);
+			}
+			TestEqual(TEXT("Committed"), ResumedJournal.GetNumCommitted(), 2);
+			TestEqual(TEXT("Retried"), ResumedJournal.GetNumRetried(), 1);
+
+			IFileManager::Get().Delete(*Filename);
+		});
+
+		It("does not mark a batch stopped by a failed check-out as done", [this]()
+		{
+			const TArray<FAssetData> Assets = { MakeAssetData(TEXT("M_Rock_Inst")), MakeAssetData(TEXT("M_Sand_Inst")), MakeAssetData(TEXT("M_Grass_Inst")) };
+			FAssetNameIndex NameIndex;
+			const FRenamePlan Plan = FAssetRenameUtil::PlanRenames(Assets, FRenameRuleSet(TEXT("MI_"), TEXT("M_")), NameIndex);
+
+			// The first batch was checked out and renamed; the check-out of the second batch failed, and the third was never reached.
+			TArray<FRenameOutcome> Outcomes;
+			Outcomes.SetNum(2);
+			Outcomes[0].OldObjectPath = Plan.GetEntries()[0].OldObjectPath;
+			Outcomes[0].Result = ERenameResult::Renamed;
+			Outcomes[1].OldObjectPath = Plan.GetEntries()[1].OldObjectPath;
+			Outcomes[1].Result = ERenameResult::Failed;
+
+			const FString Filename = FPaths::AutomationTransientDir() / TEXT("MaterialInstanceRenamerSpec.journal");
+			const FRenameJournal::FRunKey Key{ 0, TestPackagePath.ToString(), 0, 1 };
+			FRenameJournal Journal;
+			TestTrue(TEXT("Begin"), Journal.Begin(Filename, Key, Plan));
+			TestTrue(TEXT("BeginWindow"), Journal.BeginWindow(0, Plan.Num()));
+			TestTrue(TEXT("CommitWindow"), Journal.CommitWindow(0, Outcomes));
+
+			FRenamePlan Remaining;
+			FRenameJournal ResumedJournal;
+			if (TestTrue(TEXT("Load"), ResumedJournal.Load(Filename, Key, Remaining)) && TestEqual(TEXT("Remaining"), Remaining.Num(), 2))
+			{
+				TestEqual(TEXT("Failed batch"), Remaining.GetEntries()[0].OldObjectPath.ToString(), Assets[1].GetSoftObjectPath().ToString());
+				TestEqual(TEXT("Unreached batch"), Remaining.GetEntries()[1].OldObjectPath.ToString(), Assets[2].GetSoftObjectPath().ToString());
+			}
+			TestEqual(TEXT("Committed"), ResumedJournal.GetNumCommitted(), 1);
+
+			IFileManager::Get().Delete(*Filename);
+		});
+	});
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
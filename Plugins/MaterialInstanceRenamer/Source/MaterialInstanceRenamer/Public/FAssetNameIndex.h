@@ -0,0 +1,54 @@
+// Copyright 2026 kurorekish. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class IAssetRegistry;
+
+/**
+ * In-memory index of the object names that exist in each package path.
+ * Used to resolve name collisions with O(1) lookups, including collisions between
+ * assets that are renamed in the same run.
+ */
+class FAssetNameIndex
+{
+public:
+	/**
+	 * Adds every asset the registry knows about in the given package paths (non-recursive).
+	 *
+	 * @param AssetRegistry The registry to query.
+	 * @param PackagePaths The package paths to index (e.g. "/Game/Materials").
+	 */
+	void AddPackagePaths(const IAssetRegistry& AssetRegistry, TConstArrayView<FName> PackagePaths);
+
+	/**
+	 * Marks a name as used in a package path.
+	 *
+	 * @param PackagePath The package path that contains the object.
+	 * @param ObjectName The name of the object (or of its package).
+	 */
+	void AddName(FName PackagePath, FName ObjectName);
+
+	/**
+	 * @return True if the name is already used in the package path.
+	 */
+	bool Contains(FName PackagePath, FName ObjectName) const;
+
+	/**
+	 * Finds a name that is not used in the package path and reserves it.
+	 * Uses the same suffix scheme as IAssetTools::CreateUniqueAssetName: BaseName, then BaseName1, BaseName2, ...
+	 *
+	 * @param PackagePath The package path the object will live in.
+	 * @param BaseName The desired name.
+	 * @return The reserved unique name.
+	 */
+	FName ReserveUniqueName(FName PackagePath, FStringView BaseName);
+
+	/** @return True if the package path has already been indexed. */
+	bool HasPackagePath(FName PackagePath) const { return NamesByPath.Contains(PackagePath); }
+
+private:
+	/** Object and package names in use, keyed by package path. FName comparison is case-insensitive like package names. */
+	TMap<FName, TSet<FName>> NamesByPath;
+};
@@ -3,8 +3,13 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "UObject/SoftObjectPath.h"
+#include "Algo/Count.h"
 
 struct FAssetData;
+class FAssetNameIndex;
+class FRenameRuleSet;
+class FRenameRuleTable;
 
 /**
  * Enum representing the result of a rename operation.
@@ -17,6 +22,176 @@ enum class ERenameResult
 	InvalidPattern, // The asset name did not match any of the expected patterns for renaming.
 };
 
+/**
+ * Per-asset outcome of a batched rename operation.
+ */
+struct FRenameOutcome
+{
+	/** Object path of the asset before the rename. */
+	FSoftObjectPath OldObjectPath;
+
+	/** The new asset name if the asset was renamed, empty otherwise. */
+	FString NewName;
+
+	/** The result of the rename for this asset. */
+	ERenameResult Result = ERenameResult::Failed;
+
+	/** Short explanation of the result. Always points to a static string. */
+	const TCHAR* Reason = TEXT("");
+
+	/** Time spent loading the asset before the rename, in seconds. Zero if nothing was loaded. */
+	double LoadSeconds = 0.0;
+
+	/**
+	 * The asset's share of the RenameAssets call it was submitted with, in seconds: the call's duration
+	 * divided by the number of assets in it. Zero if the asset was not submitted.
+	 */
+	double RenameSeconds = 0.0;
+};
+
+/**
+ * A single planned rename, computed from asset registry data only.
+ */
+struct FRenamePlanEntry
+{
+	/** Object path of the asset before the rename. */
+	FSoftObjectPath OldObjectPath;
+
+	/** Object path the asset will be renamed to. Only set when Result is Renamed. */
+	FSoftObjectPath NewObjectPath;
+
+	/** The planned result. Renamed means the asset will be renamed when the plan is executed. */
+	ERenameResult Result = ERenameResult::Failed;
+
+	/** Short explanation of the planned result. Always points to a static string. */
+	const TCHAR* Reason = TEXT("");
+
+	/** Number of packages that reference the asset. Only set for planned renames of a plan grouped by referencers. */
+	int32 NumReferencers = 0;
+};
+
+/**
+ * Referencer statistics of a rename plan, gathered by FAssetRenameUtil::GroupRenamesByReferencers.
+ */
+struct FReferencerFanout
+{
+	/** Distinct packages that reference at least one planned rename. */
+	int32 NumReferencers = 0;
+
+	/** Sum of the referencer counts of all planned renames. */
+	int32 NumReferences = 0;
+
+	/** The package that references the most planned renames, and how many it references. */
+	FName HeaviestReferencer;
+	int32 HeaviestReferencerFanout = 0;
+
+	/**
+	 * Estimated referencer loads during execution: one per referencer and per batch that renames something it references.
+	 * Measured for the plan order before and after grouping.
+	 */
+	int32 EstimatedLoadsBefore = 0;
+	int32 EstimatedLoadsAfter = 0;
+};
+
+/**
+ * Immutable list of planned renames produced by FAssetRenameUtil::PlanRenames.
+ * Building a plan never loads a package, so the same plan can be printed for a dry run
+ * or handed to FAssetRenameUtil::ExecuteRenamePlan for the real run.
+ */
+class FRenamePlan
+{
+public:
+	/**
+	 * Rebuilds a plan from entries planned earlier, e.g. read back from a rename journal. The entries are taken as-is;
+	 * name counters and referencer statistics are left empty.
+	 */
+	static FRenamePlan FromEntries(TArray<FRenamePlanEntry> InEntries)
+	{
+		FRenamePlan Plan;
+		Plan.Entries = MoveTemp(InEntries);
+		return Plan;
+	}
+
+	/** @return All planned entries, in the order of the assets the plan was built from, or in execution order once grouped by referencers. */
+	TConstArrayView<FRenamePlanEntry> GetEntries() const { return Entries; }
+
+	/** @return The number of entries in the plan. */
+	int32 Num() const { return Entries.Num(); }
+
+	/** @return The number of entries whose planned result is Result. */
+	int32 CountResult(ERenameResult Result) const
+	{
+		return Algo::CountIf(Entries, [Result](const FRenamePlanEntry& Entry) { return Entry.Result == Result; });
+	}
+
+	/** @return The number of new names built while planning (one per planned rename). */
+	int32 GetNumNewNames() const { return NumNewNames; }
+
+	/** @return The number of assets classified without building a new name (skipped and invalid names). */
+	int32 GetNumNamesKept() const { return NumNamesKept; }
+
+	/** @return The referencer statistics of the plan. Empty unless the plan was grouped by referencers. */
+	const FReferencerFanout& GetReferencerFanout() const { return ReferencerFanout; }
+
+private:
+	friend class FAssetRenameUtil;
+
+	TArray<FRenamePlanEntry> Entries;
+	int32 NumNewNames = 0;
+	int32 NumNamesKept = 0;
+	FReferencerFanout ReferencerFanout;
+};
+
+/**
+ * Options controlling how a batched rename is submitted to AssetTools.
+ */
+struct FRenameBatchOptions
+{
+	/** Maximum number of assets submitted to a single IAssetTools::RenameAssets call. */
+	int32 BatchSize = 500;
+
+	/**
+	 * Whether each batch checks out the packages it will touch from source control in one operation before
+	 * it is renamed, instead of leaving AssetTools to check them out as it reaches them. A failed check-out
+	 * stops the execution before the batch. Has no effect without an enabled source control provider.
+	 * See FRenameSourceControl.
+	 */
+	bool bBulkCheckOut = false;
+
+	/**
+	 * Called after each batch with the number of assets processed so far and the total.
+	 * Returning false cancels the remaining batches.
+	 */
+	TFunction<bool(int32 NumProcessed, int32 NumTotal)> OnBatchCompleted;
+};
+
+/**
+ * What executing a rename plan would touch, estimated from asset registry data only.
+ */
+struct FRenameImpactEstimate
+{
+	/** Material Instances that would be renamed. */
+	int32 NumRenames = 0;
+
+	/** Distinct packages, other than the renamed ones, that reference a renamed Material Instance and would be dirtied. */
+	int32 NumReferencers = 0;
+
+	/** On-disk size of the renamed packages and of the referencer packages, in bytes, as recorded by the registry. */
+	int64 RenamedBytes = 0;
+	int64 ReferencerBytes = 0;
+};
+
+/**
+ * Totals of a redirector fix-up pass.
+ */
+struct FRedirectorFixupResult
+{
+	/** Redirectors found at the old paths of the renamed assets. */
+	int32 NumRedirectors = 0;
+
+	/** Redirectors deleted because no referencer pointed at them any more. */
+	int32 NumDeleted = 0;
+};
 
 /**
  * Utility class for renaming Material Instance assets.
@@ -35,23 +210,136 @@ public:
 	 */
 	static ERenameResult RenameMaterialInstance(const FAssetData& SelectedAsset, FString& OutNewName);
 
+	/**
+	 * Renames a set of material instance assets, submitting them to AssetTools in chunks so that
+	 * referencers shared by several assets are loaded, fixed up and dirtied once per chunk
+	 * instead of once per asset. Equivalent to PlanRenames, GroupRenamesByReferencers and ExecuteRenamePlan.
+	 * Assets of other classes are renamed with the rules the plugin settings define for their class, if any.
+	 *
+	 * @param Assets The asset data of the assets to rename.
+	 * @param OutOutcomes Receives one outcome per processed asset, in execution order (renames grouped by referencer first).
+	 *                    Assets left unprocessed because of a cancellation have no outcome.
+	 * @param Options Batch size and progress reporting options.
+	 */
+	static void RenameMaterialInstances(TConstArrayView<FAssetData> Assets, TArray<FRenameOutcome>& OutOutcomes, const FRenameBatchOptions& Options = FRenameBatchOptions());
+
+	/**
+	 * Decides, for every asset, whether it will be renamed and to which path.
+	 * Only asset registry data is used; no package is loaded and nothing is modified.
+	 * Each asset is classified with the rules the plugin settings define for its class.
+	 *
+	 * @param Assets The asset data of the assets to plan for.
+	 * @return The immutable rename plan, one entry per asset.
+	 */
+	static FRenamePlan PlanRenames(TConstArrayView<FAssetData> Assets);
+
+	/**
+	 * Same as PlanRenames(Assets), but resolves name collisions against a caller-provided index.
+	 * Package paths of the assets that are missing from the index are added from the registry,
+	 * and every planned name is reserved in it, so consecutive plans never collide with each other.
+	 *
+	 * @param Assets The asset data of the material instances to plan for.
+	 * @param NameIndex The name index to resolve collisions against.
+	 * @return The immutable rename plan, one entry per asset.
+	 */
+	static FRenamePlan PlanRenames(TConstArrayView<FAssetData> Assets, FAssetNameIndex& NameIndex);
+
+	/**
+	 * Same as PlanRenames(Assets, NameIndex), but classifies names with an explicit, pre-compiled rule set
+	 * instead of compiling one from the plugin settings. Callers that plan repeatedly should compile once and reuse it.
+	 * Does not touch the plugin settings, so it may be called from a worker thread.
+	 *
+	 * @param Assets The asset data of the material instances to plan for.
+	 * @param Rules The compiled naming rules.
+	 * @param NameIndex The name index to resolve collisions against.
+	 * @return The immutable rename plan, one entry per asset.
+	 */
+	static FRenamePlan PlanRenames(TConstArrayView<FAssetData> Assets, const FRenameRuleSet& Rules, FAssetNameIndex& NameIndex);
+
+	/**
+	 * Same as PlanRenames(Assets, Rules, NameIndex), but classifies every asset with the rules of its class,
+	 * so the assets of all handled classes can come from one registry query and be planned in one pass.
+	 * Assets whose class has no rules are planned as Skipped. May be called from a worker thread.
+	 *
+	 * @param Assets The asset data of the assets to plan for, of any class.
+	 * @param Rules The compiled naming rules, keyed by class.
+	 * @param NameIndex The name index to resolve collisions against.
+	 * @return The immutable rename plan, one entry per asset.
+	 */
+	static FRenamePlan PlanRenames(TConstArrayView<FAssetData> Assets, const FRenameRuleTable& Rules, FAssetNameIndex& NameIndex);
+
+	/**
+	 * Reorders a plan so that Material Instances sharing a referencer are renamed in the same batch.
+	 * Referencers are taken from the asset registry and visited heaviest first; each one pulls all of its
+	 * renames that are not placed yet into one contiguous run, so a level or Blueprint that references many
+	 * of them is loaded and fixed up by as few RenameAssets calls as possible. Renames without referencers
+	 * follow, and entries that are not renamed go last. Only registry data is used, so it may run on a worker thread.
+	 *
+	 * @param Plan The plan to reorder. Receives the referencer count of every planned rename and the fan-out statistics.
+	 * @param BatchSize The batch size the plan will be executed with, used to estimate referencer loads.
+	 */
+	static void GroupRenamesByReferencers(FRenamePlan& Plan, int32 BatchSize);
+
+	/**
+	 * Estimates the cost of executing a plan without loading any package: the number of renames,
+	 * the distinct referencer packages that would be dirtied, and the on-disk size of both.
+	 *
+	 * @param Plan The plan to estimate.
+	 * @return The estimate.
+	 */
+	static FRenameImpactEstimate EstimateImpact(const FRenamePlan& Plan);
+
+	/**
+	 * @return The number of asset names classified without building a new name since the module was loaded.
+	 */
+	static int64 GetNumNamesKept();
+
+	/**
+	 * Executes the renames of a plan, submitting them to AssetTools in chunks.
+	 * Entries that are not planned as Renamed are passed through unchanged.
+	 *
+	 * @param Entries The plan entries to execute (a whole plan or a contiguous slice of one).
+	 * @param OutOutcomes Receives one outcome per processed entry, in the order of Entries.
+	 *                    Entries left unprocessed because of a cancellation or a failed check-out have no outcome.
+	 * @param Options Batch size and progress reporting options.
+	 * @return False if execution stopped because the packages of a batch could not be checked out.
+	 *         The assets of that batch are reported as Failed and nothing after it is processed.
+	 */
+	static bool ExecuteRenamePlan(TConstArrayView<FRenamePlanEntry> Entries, TArray<FRenameOutcome>& OutOutcomes, const FRenameBatchOptions& Options = FRenameBatchOptions());
+
 	/**
 	 * Extracts the base name from a material instance asset's name according to defined patterns.
 	 *
 	 * @param OldAssetName The current name of the asset.
+	 * @param Rules The compiled naming rules to match against. Compile them once and reuse them across calls.
 	 * @param OutBaseName The extracted base name, if a pattern is matched.
 	 * @return True if a pattern was matched and the base name was extracted, false otherwise.
 	 */
-	static bool ExtractBaseName(const FString& OldAssetName, FString& OutBaseName);
+	static bool ExtractBaseName(const FString& OldAssetName, const FRenameRuleSet& Rules, FString& OutBaseName);
 
-private:
 	/**
-	 * Performs the actual asset rename using the AssetTools module.
+	 * Checks whether an asset is a Material Instance Constant, or a subclass of one, from registry data alone.
+	 * The asset's class path is compared against a set computed once from the native class hierarchy,
+	 * so the asset's class is never resolved or loaded.
 	 *
-	 * @param AssetToRename The asset data of the asset to rename.
-	 * @param NewName The desired new name for the asset.
-	 * @param OutNewName The new name of the asset if the rename was successful.
-	 * @return True if the rename was successful, false otherwise.
+	 * @param AssetData The asset to check.
+	 * @return True if the asset is a Material Instance Constant.
 	 */
-	static bool RenameAsset(const FAssetData& AssetToRename, const FString& NewName, FString& OutNewName);
+	static bool IsMaterialInstance(const FAssetData& AssetData);
+
+	/**
+	 * Resolves the redirectors left behind by renamed assets in a single AssetTools fix-up pass:
+	 * every referencer of the redirectors is loaded once, repointed at the new paths and saved,
+	 * and redirectors that no referencer points at any more are deleted.
+	 * Paths without a redirector (e.g. already fixed up) are ignored.
+	 *
+	 * @param OldObjectPaths Object paths of the assets before they were renamed.
+	 * @param bPromptForCheckout Whether AssetTools may show the source control checkout dialog.
+	 * @return The number of redirectors found and deleted.
+	 */
+	static FRedirectorFixupResult FixupRedirectors(TConstArrayView<FSoftObjectPath> OldObjectPaths, bool bPromptForCheckout);
+
+private:
+	/** Shared implementation of the PlanRenames overloads. FindRules returns the rules for an asset, or nullptr to skip it. */
+	static FRenamePlan PlanRenames(TConstArrayView<FAssetData> Assets, TFunctionRef<const FRenameRuleSet*(const FAssetData&)> FindRules, FAssetNameIndex& NameIndex);
 };
\ No newline at end of file
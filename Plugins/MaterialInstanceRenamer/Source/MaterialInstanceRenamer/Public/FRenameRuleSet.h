@@ -0,0 +1,135 @@
+// Copyright 2026 kurorekish. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FAssetRenameUtil.h"
+
+class UMaterialInstanceRenamerSettings;
+
+/**
+ * Immutable, compiled set of naming rules used to classify asset names.
+ *
+ * All prefixes and suffixes are compiled into two tries, so a name is matched in a single pass
+ * over its characters and the cost does not depend on the number of configured rules.
+ * All member functions are const and touch no shared state, so a single rule set can be used
+ * from any number of threads at once. Build it on the game thread, then share it.
+ */
+class FRenameRuleSet
+{
+public:
+	/**
+	 * Compiles the rules for a single source prefix, the "_Inst" suffix and the legacy "MI_" prefix.
+	 *
+	 * @param InRenamePrefix The prefix renamed assets receive (e.g. "MI_").
+	 * @param InSourcePrefix The prefix to strip from the old name (e.g. "M_").
+	 */
+	FRenameRuleSet(const FString& InRenamePrefix, const FString& InSourcePrefix);
+
+	/**
+	 * Compiles the rules.
+	 *
+	 * @param InRenamePrefix The prefix renamed assets receive (e.g. "MI_").
+	 * @param SourcePrefixes Prefixes to strip from the old name (e.g. "M_", "MM_").
+	 * @param InstanceSuffixes Suffixes to strip from the old name (e.g. "_Inst", "_MI").
+	 * @param LegacyPrefixes Outdated rename prefixes; a legacy prefix followed by a source prefix is stripped as a whole.
+	 */
+	FRenameRuleSet(const FString& InRenamePrefix, TConstArrayView<FString> SourcePrefixes, TConstArrayView<FString> InstanceSuffixes, TConstArrayView<FString> LegacyPrefixes);
+
+	/**
+	 * Compiles the rules from the plugin settings. Reads the settings object, so call it on the game thread.
+	 *
+	 * @param Settings The settings to compile.
+	 * @return The compiled rule set.
+	 */
+	static FRenameRuleSet FromSettings(const UMaterialInstanceRenamerSettings& Settings);
+
+	/**
+	 * Decides whether an asset name needs to be renamed and, if so, which name it should get.
+	 *
+	 * @param AssetName The current name of the asset.
+	 * @param OutNewAssetName The recommended new name (before uniqueness is applied) if a rename is needed.
+	 * @return Renamed if a rename is needed, otherwise Skipped or InvalidPattern.
+	 */
+	ERenameResult Classify(FStringView AssetName, FString& OutNewAssetName) const;
+
+	/**
+	 * Extracts the base name from an asset name according to the compiled rules.
+	 *
+	 * @param AssetName The current name of the asset.
+	 * @param OutBaseName The extracted base name, a view into AssetName.
+	 * @return True if a rule was matched, false otherwise.
+	 */
+	bool ExtractBaseName(FStringView AssetName, FStringView& OutBaseName) const;
+
+	/** @return The prefix renamed assets receive. */
+	const FString& GetRenamePrefix() const { return RenamePrefix; }
+
+	/** @return A hash of every rule the set was compiled from. Changes whenever a rule changes. */
+	uint32 GetFingerprint() const { return Fingerprint; }
+
+private:
+	/** Priority of a prefix; lower values win. */
+	enum class EPrefixRank : uint8
+	{
+		RenameAndSource, // Rename prefix followed by a source prefix, e.g. "MI_M_".
+		LegacyAndSource, // Legacy prefix followed by a source prefix.
+		Source,          // A source prefix on its own.
+		None,            // No prefix; only valid together with a suffix.
+	};
+
+	/** A prefix or suffix found at the start or end of a name. */
+	struct FAffixMatch
+	{
+		int32 Length = 0;
+		EPrefixRank Rank = EPrefixRank::None;
+	};
+
+	using FAffixMatchArray = TArray<FAffixMatch, TInlineAllocator<8>>;
+
+	/** Case-insensitive character trie over prefixes, or over reversed suffixes. */
+	class FAffixTrie
+	{
+	public:
+		explicit FAffixTrie(bool bInReversed);
+
+		/** Adds an affix. If it is already present, the better rank is kept. */
+		void Add(FStringView Affix, EPrefixRank Rank);
+
+		/** Collects every stored affix found at the start (or end, if reversed) of Name, shortest first. */
+		void FindMatches(FStringView Name, FAffixMatchArray& OutMatches) const;
+
+	private:
+		struct FNode
+		{
+			TArray<TPair<TCHAR, int32>, TInlineAllocator<2>> Children;
+			bool bTerminal = false;
+			EPrefixRank Rank = EPrefixRank::None;
+		};
+
+		int32 FindChild(int32 NodeIndex, TCHAR Char) const;
+
+		TArray<FNode> Nodes;
+		bool bReversed;
+	};
+
+	/**
+	 * Finds the best prefix/suffix combination for a name.
+	 *
+	 * @return True if a combination leaving a non-empty base name was found.
+	 */
+	bool MatchAffixes(FStringView AssetName, int32& OutPrefixLen, int32& OutSuffixLen, EPrefixRank& OutRank) const;
+
+	FString RenamePrefix;
+	FAffixTrie PrefixTrie;
+	FAffixTrie SuffixTrie;
+
+	/** True if the rename prefix is MI_, whose names followed by a source prefix (e.g. MI_M_) are renamed instead of skipped. */
+	bool bCleanUpRenamePrefixed = false;
+
+	/** True if an empty source prefix is configured, which allows names without any prefix to be renamed. */
+	bool bAllowBareNames = false;
+
+	/** Hash of the rename prefix and every configured prefix and suffix. */
+	uint32 Fingerprint = 0;
+};
@@ -0,0 +1,71 @@
+// Copyright 2026 kurorekish. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FRenameRuleSet.h"
+#include "UObject/TopLevelAssetPath.h"
+
+struct FAssetData;
+class UMaterialInstanceRenamerSettings;
+
+/**
+ * Compiled naming rules for every handled asset class, keyed by class path.
+ *
+ * Lets one registry query return the assets of all handled classes and one classification pass
+ * dispatch each asset to the rule set of its class, instead of running a query and a pass per class.
+ * Lookups only compare class paths, so an asset's class is never resolved or loaded.
+ * Like FRenameRuleSet, the table is immutable once built and may be shared across threads.
+ */
+class FRenameRuleTable
+{
+public:
+	/**
+	 * Adds the rules for a class. Where configured classes overlap, every class uses the rules of its
+	 * nearest configured ancestor, or its own if it was added explicitly, whatever the order they were added in.
+	 * A class added twice keeps the rules added last. Overlaps are logged as warnings.
+	 * Call it on the game thread when subclasses are included.
+	 *
+	 * @param ClassPath The class the rules apply to.
+	 * @param Rules The compiled rules.
+	 * @param bIncludeSubclasses Whether the native and loaded subclasses of the class use the rules too.
+	 */
+	void Add(const FTopLevelAssetPath& ClassPath, FRenameRuleSet Rules, bool bIncludeSubclasses = true);
+
+	/**
+	 * Compiles the Material Instance rules and every additional asset class rule of the plugin settings.
+	 * Rules whose class is not set are ignored. Reads the settings object, so call it on the game thread.
+	 *
+	 * @param Settings The settings to compile.
+	 * @return The compiled table.
+	 */
+	static FRenameRuleTable FromSettings(const UMaterialInstanceRenamerSettings& Settings);
+
+	/** @return The rules for a class, or nullptr if the class is not handled. */
+	const FRenameRuleSet* Find(const FTopLevelAssetPath& ClassPath) const;
+
+	/** @return The rules for the class of an asset, or nullptr if the class is not handled. */
+	const FRenameRuleSet* Find(const FAssetData& AssetData) const;
+
+	/** @return Every handled class path, including subclasses, for use as the ClassPaths of a registry filter. */
+	TArray<FTopLevelAssetPath> GetClassPaths() const;
+
+	/** @return The number of handled class paths. */
+	int32 NumClasses() const { return RuleSetIndexByClass.Num(); }
+
+	/** @return A hash of every class and the fingerprint of its rules. Changes whenever a rule or a class mapping changes. */
+	uint32 GetFingerprint() const;
+
+private:
+	/** A class mapped to a rule set, and the configured class the rules were added for. */
+	struct FClassEntry
+	{
+		int32 RuleSetIndex = INDEX_NONE;
+		FTopLevelAssetPath ConfiguredClass;
+		/** Number of inheritance steps from the configured class; 0 if the class was added explicitly. */
+		int32 Depth = MAX_int32;
+	};
+
+	TArray<FRenameRuleSet> RuleSets;
+	TMap<FTopLevelAssetPath, FClassEntry> RuleSetIndexByClass;
+};
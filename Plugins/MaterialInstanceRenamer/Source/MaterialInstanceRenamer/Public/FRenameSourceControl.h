@@ -0,0 +1,65 @@
+// Copyright 2026 kurorekish. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Function.h"
+
+struct FRenamePlanEntry;
+
+/**
+ * Bulk source control operations for a batch of renames.
+ *
+ * AssetTools checks out and marks the packages of a rename through the source control provider as it reaches them.
+ * For a batch, the packages it will touch are known from the asset registry beforehand: the renamed packages, which
+ * become redirectors, the referencers that get fixed up, and the new packages. They are checked out with one status
+ * query and one operation before the batch is renamed, and the new packages are marked for add with one operation
+ * once they are saved, so AssetTools finds every file already writable. Without an enabled and available provider
+ * every operation is a no-op.
+ */
+class FRenameSourceControl
+{
+public:
+	/** Long package names a batch of renames will touch. */
+	struct FBatchPackages
+	{
+		/** Existing packages that are modified: the renamed packages and their referencers, without duplicates. */
+		TArray<FString> PackagesToCheckOut;
+
+		/** Packages created by the renames. */
+		TArray<FString> PackagesToAdd;
+	};
+
+	/**
+	 * Works out the packages a batch of renames will touch. Entries that are not planned as Renamed are ignored.
+	 *
+	 * @param Entries The plan entries of the batch.
+	 * @param GetReferencers Appends the packages that reference a package.
+	 * @return The packages to check out and to add.
+	 */
+	static FBatchPackages GatherBatchPackages(TConstArrayView<FRenamePlanEntry> Entries, TFunctionRef<void(FName PackageName, TArray<FName>& OutReferencers)> GetReferencers);
+
+	/** Works out the packages a batch of renames will touch, with the referencers recorded by the asset registry. */
+	static FBatchPackages GatherBatchPackages(TConstArrayView<FRenamePlanEntry> Entries);
+
+	/** @return True if a source control provider is enabled and available, so the operations below do anything. */
+	static bool IsActive();
+
+	/**
+	 * Checks out every package that is under source control and not checked out yet, with one status query and one
+	 * check-out operation. Packages that do not exist on disk are ignored. Call it on the game thread.
+	 *
+	 * @param PackageNames The long package names to check out.
+	 * @return False if the check-out operation failed.
+	 */
+	static bool CheckOutPackages(TConstArrayView<FString> PackageNames);
+
+	/**
+	 * Marks every file that is not under source control yet for add, with one status query and one operation.
+	 * Call it on the game thread once the files are written.
+	 *
+	 * @param Filenames The package files to add.
+	 * @return False if the add operation failed.
+	 */
+	static bool MarkFilesForAdd(TConstArrayView<FString> Filenames);
+};
@@ -4,6 +4,11 @@
 
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
+#include "AssetRegistry/AssetData.h"
+#include "Containers/Ticker.h"
+#include "FRenameRuleTable.h"
+
+class FAsyncRenameAllOperation;
 
 /**
  * Main module class for the Material Instance Renamer plugin.
@@ -37,12 +42,43 @@ private:
 	 */
     void UnregisterSettings();
 
+	/**
+	 * Called when the plugin settings are modified in the Project Settings window.
+	 *
+	 * @return True so the modified settings are saved.
+	 */
+	bool HandleSettingsModified();
+
+	/**
+	 * Binds OnAssetAdded to the asset registry while auto-rename is enabled and the initial scan has finished,
+	 * and unbinds it otherwise, so disabled auto-rename costs nothing per discovered asset.
+	 */
+	void UpdateAutoRenameBinding();
+
+	/**
+	 * Called once the asset registry's initial scan has finished.
+	 */
+	void OnInitialAssetScanCompleted();
+
 	/**
 	 * Callback function for the "Rename All Material Instances" menu action.
 	 * Triggers a batch rename operation for all material instances in the project.
 	 */
 	void OnRenameAllMaterialInstancesClicked();
 
+	/**
+	 * Renames all material instances in the project inside a modal progress dialog.
+	 * Used when non-blocking Rename All is disabled in the settings.
+	 */
+	void RenameAllMaterialInstancesBlocking();
+
+	/**
+	 * Callback function for the "Estimate Rename All" menu action.
+	 * Shows what "Rename All Material Instances" would rename and dirty, and how long it is projected to take,
+	 * using asset registry data only.
+	 */
+	void OnEstimateRenameAllClicked();
+
 	/**
 	 * Adds the "Material Instance Renamer" entry to the Level Editor's Tools menu.
 	 */
@@ -56,12 +92,24 @@ private:
 
 	/**
 	 * Callback function called when a new asset is added to the registry.
-	 * Checks if the asset is a Material Instance and performs auto-renaming if enabled.
+	 * Checks if the asset's class has naming rules and queues it for auto-renaming if enabled.
 	 *
 	 * @param AssetData metadata for the newly added asset.
 	 */
 	void OnAssetAdded(const FAssetData& AssetData);
 
+	/**
+	 * Ticker callback that waits until no asset has been queued for the debounce window, then flushes the queue.
+	 *
+	 * @return True to keep ticking, false once the queue has been flushed.
+	 */
+	bool TickPendingAutoRenames(float DeltaTime);
+
+	/**
+	 * Renames all queued assets in a single batch and shows one aggregated notification.
+	 */
+	void FlushPendingAutoRenames();
+
 	/**
 	 * Registers all menu extensions (Tools menu and Content Browser context menu).
 	 */
@@ -69,4 +117,28 @@ private:
 
 	/** Flag to prevent recursive renaming loops when modifying assets. */
 	bool bIsRenamingAsset = false;
+
+	/** Naming rules checked by OnAssetAdded; compiled while auto-rename is enabled. */
+	FRenameRuleTable AutoRenameRules;
+
+	/** Assets added since the last flush, waiting to be auto-renamed together. */
+	TArray<FAssetData> PendingAutoRenameAssets;
+
+	/** Time the last asset was queued for auto-renaming. */
+	double LastAutoRenameQueueTime = 0.0;
+
+	/** Ticker that flushes the auto-rename queue; valid while assets are queued. */
+	FTSTicker::FDelegateHandle AutoRenameTickerHandle;
+
+	/** OnAssetAdded binding; valid only while auto-rename is enabled. */
+	FDelegateHandle AssetAddedHandle;
+
+	/** OnFilesLoaded binding; valid until the initial asset registry scan has finished. */
+	FDelegateHandle FilesLoadedHandle;
+
+	/** Time spent in StartupModule and in binding auto-rename after the initial scan, for startup cost reporting. */
+	double StartupSeconds = 0.0;
+
+	/** The running or last non-blocking "Rename All" operation. */
+	TSharedPtr<FAsyncRenameAllOperation> RenameAllOperation;
 };
\ No newline at end of file
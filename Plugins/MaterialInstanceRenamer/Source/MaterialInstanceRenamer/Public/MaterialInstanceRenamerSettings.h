@@ -4,8 +4,42 @@
 
 #include "CoreMinimal.h"
 #include "UObject/Object.h"
+#include "UObject/SoftObjectPtr.h"
 #include "MaterialInstanceRenamerSettings.generated.h"
 
+/**
+ * Naming rule for one asset class other than Material Instances.
+ */
+USTRUCT()
+struct MATERIALINSTANCERENAMER_API FAssetClassNamingRule
+{
+	GENERATED_BODY()
+
+	/** The asset class the rule applies to (e.g. Texture2D). */
+	UPROPERTY(Config, EditAnywhere, Category = "Rule", meta = (DisplayName = "Asset Class", AllowAbstract = "true"))
+	TSoftClassPtr<UObject> AssetClass;
+
+	/** Also applies the rule to subclasses of the asset class that have no rule of their own. */
+	UPROPERTY(Config, EditAnywhere, Category = "Rule", meta = (DisplayName = "Include Subclasses"))
+	bool bIncludeSubclasses = true;
+
+	/** The prefix renamed assets of the class receive (e.g. "T_"). */
+	UPROPERTY(Config, EditAnywhere, Category = "Rule", meta = (DisplayName = "Rename Prefix"))
+	FString RenamePrefix;
+
+	/** Prefixes to search for and remove. Add an empty entry to also rename names without any prefix. */
+	UPROPERTY(Config, EditAnywhere, Category = "Rule", meta = (DisplayName = "Source Prefixes"))
+	TArray<FString> SourcePrefixes;
+
+	/** Suffixes to search for and remove (e.g. "_Tex"). */
+	UPROPERTY(Config, EditAnywhere, Category = "Rule", meta = (DisplayName = "Suffixes"))
+	TArray<FString> Suffixes;
+
+	/** Outdated rename prefixes. A legacy prefix followed by a source prefix is removed as a whole. */
+	UPROPERTY(Config, EditAnywhere, Category = "Rule", meta = (DisplayName = "Legacy Prefixes"))
+	TArray<FString> LegacyPrefixes;
+};
+
 /**
  * Settings for the Material Instance Renamer plugin.
  */
@@ -25,10 +59,44 @@ public:
 	UPROPERTY(Config, EditAnywhere, Category = "Renaming", meta = (DisplayName = "Source Prefix (Target to Replace)"))
 	FString SourcePrefix;
 
+	/** Further prefixes to search for and remove, in addition to the Source Prefix (e.g. "MM_", "Mat_"). */
+	UPROPERTY(Config, EditAnywhere, Category = "Renaming|Rules", meta = (DisplayName = "Additional Source Prefixes"))
+	TArray<FString> AdditionalSourcePrefixes;
+
+	/** Suffixes that mark an instance and are removed from the old name (e.g. "_Inst", "_MI", "_Instance"). */
+	UPROPERTY(Config, EditAnywhere, Category = "Renaming|Rules", meta = (DisplayName = "Instance Suffixes"))
+	TArray<FString> InstanceSuffixes;
+
+	/** Outdated rename prefixes. A legacy prefix followed by a source prefix is removed as a whole (e.g. "MI_M_Rock" becomes "P_Rock"). */
+	UPROPERTY(Config, EditAnywhere, Category = "Renaming|Rules", meta = (DisplayName = "Legacy Prefixes"))
+	TArray<FString> LegacyPrefixes;
+
+	/**
+	 * Naming rules for further asset classes. Rename All, the commandlet and Auto-Rename on Create handle these classes
+	 * in the same registry pass as Material Instances. The rules above always apply to Material Instances.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Renaming|Asset Classes", meta = (DisplayName = "Additional Asset Class Rules", TitleProperty = "RenamePrefix"))
+	TArray<FAssetClassNamingRule> AssetClassRules;
+
 	/** Enables/disables automatic renaming of Material Instance assets when they are created. */
 	UPROPERTY(Config, EditAnywhere, Category = "Renaming", meta = (DisplayName = "Auto-Rename on Create"))
 	bool bAutoRenameOnCreate;
 
+	/** Runs "Rename All Material Instances" in the background with a progress notification instead of a modal dialog. */
+	UPROPERTY(Config, EditAnywhere, Category = "Renaming|Rename All", meta = (DisplayName = "Non-Blocking Rename All"))
+	bool bNonBlockingRenameAll;
+
+	/** Time per editor frame spent renaming when Non-Blocking Rename All is enabled, in milliseconds. */
+	UPROPERTY(Config, EditAnywhere, Category = "Renaming|Rename All", meta = (DisplayName = "Frame Budget (ms)", ClampMin = "1.0", EditCondition = "bNonBlockingRenameAll"))
+	float NonBlockingFrameBudgetMs;
+
+	/**
+	 * After renaming from the context menu or with "Rename All Material Instances", fixes up the referencers
+	 * of the renamed assets in one pass and deletes the redirectors that are no longer referenced.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Renaming", meta = (DisplayName = "Fix Up Redirectors After Rename"))
+	bool bFixupRedirectorsAfterRename;
+
 	/** Show a notification when a Material Instance asset is automatically renamed. */
 	UPROPERTY(Config, EditAnywhere, Category = "Renaming", meta = (DisplayName = "Show Notification on Auto-Rename"))
 	bool bShowNotificationOnAutoRename;